@@ -99,6 +99,7 @@ namespace DataStormI
         [[nodiscard]] virtual Ice::ByteSeq encodeValue(const Ice::CommunicatorPtr&) = 0;
 
         [[nodiscard]] const Ice::ByteSeq& getEncodedValue() const { return _encodedValue; }
+        void setEncodedValue(Ice::ByteSeq value) { _encodedValue = std::move(value); }
 
         std::string session;
         std::string origin;
@@ -107,6 +108,11 @@ namespace DataStormI
         std::shared_ptr<Key> key;
         std::shared_ptr<Tag> tag;
         std::chrono::time_point<std::chrono::system_clock> timestamp;
+        // True if the encoded value of a received sample is a delta against the previous value of the key.
+        bool deltaEncoded{false};
+        // The number of delta encoded updates of the key since its last full value, this sample included. Only set
+        // on the samples published by a writer.
+        int deltaCount{0};
 
     protected:
         Ice::ByteSeq _encodedValue;
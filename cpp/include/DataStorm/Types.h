@@ -143,13 +143,16 @@ namespace DataStorm
         /// @param sampleLifetime The optional sample lifetime.
         /// @param clearHistory The optional clear history policy.
         /// @param priority The writer priority.
+        /// @param deltaKeyframeInterval The optional delta encoding keyframe interval.
         WriterConfig(
             std::optional<int> sampleCount = std::nullopt,
             std::optional<int> sampleLifetime = std::nullopt,
             std::optional<ClearHistoryPolicy> clearHistory = std::nullopt,
-            std::optional<int> priority = std::nullopt) noexcept
+            std::optional<int> priority = std::nullopt,
+            std::optional<int> deltaKeyframeInterval = std::nullopt) noexcept
             : Config{sampleCount, sampleLifetime, clearHistory},
-              priority{priority}
+              priority{priority},
+              deltaKeyframeInterval{deltaKeyframeInterval}
         {
         }
 
@@ -157,6 +160,15 @@ namespace DataStorm
         /// policy. nullopt is equivalent to the topic's default priority: the value of the DataStorm.Topic.Priority
         /// property (0 by default), unless replaced with Topic::setWriterDefaultConfig.
         std::optional<int> priority;
+
+        /// Enables the delta encoding of updates. When greater than 1, the writer sends an update as a delta against
+        /// the previous value of the key when the delta is smaller than the value, and sends the full value at least
+        /// once every deltaKeyframeInterval updates of the key. 1, 0 or a negative value disables delta encoding.
+        /// nullopt is equivalent to the topic's default interval: the value of the
+        /// DataStorm.Topic.DeltaKeyframeInterval property (0 by default), unless replaced with
+        /// Topic::setWriterDefaultConfig. Delta encoded updates are only sent to the nodes that support them, and
+        /// never to the readers with a sample filter, which get the full values.
+        std::optional<int> deltaKeyframeInterval;
     };
 
     /// The callback action enumerator specifies the reason why a callback is called.
@@ -418,18 +418,28 @@ namespace Ice
         /// @param[out] v A pair of pointers representing the beginning and end of the sequence elements.
         template<typename T> void read(std::pair<const T*, const T*>& v)
         {
-            auto holder = new std::vector<T>;
-            _deleters.push_back([holder] { delete holder; });
-            read(*holder);
-            if (holder->size() > 0)
+#if defined(ICE_UNALIGNED) || (defined(_WIN32) && defined(ICE_API_EXPORTS))
+            // The memory layout of the elements is their Slice encoding: point into the marshaling buffer.
+            if constexpr (HasWireLayout<T>::value)
             {
-                v.first = holder->data();
-                v.second = holder->data() + holder->size();
+                unalignedRead(v);
             }
             else
+#endif
             {
-                v.first = 0;
-                v.second = 0;
+                auto holder = new std::vector<T>;
+                _deleters.push_back([holder] { delete holder; });
+                read(*holder);
+                if (holder->size() > 0)
+                {
+                    v.first = holder->data();
+                    v.second = holder->data() + holder->size();
+                }
+                else
+                {
+                    v.first = 0;
+                    v.second = 0;
+                }
             }
         }
 
@@ -550,6 +560,19 @@ namespace Ice
         /// communicator), `false` otherwise.
         void read(const char*& vdata, size_t& vsize, bool convert = true);
 
+        /// Reads a string from the stream.
+        /// @param[out] v A view of the unmarshaled string. It points into the marshaling buffer, unless the string
+        /// converter changes the string size, and remains valid as long as this stream.
+        /// @param convert `true` to process the unmarshaled string through the string converter (if installed on the
+        /// communicator), `false` otherwise.
+        void read(std::string_view& v, bool convert = true)
+        {
+            const char* vdata = nullptr;
+            size_t vsize = 0;
+            read(vdata, vsize, convert);
+            v = std::string_view{vdata, vsize};
+        }
+
         /// Reads a sequence of strings from the stream.
         /// @param[out] v The unmarshaled string sequence.
         /// @param convert `true` to process the unmarshaled string through the string converter (if installed on the
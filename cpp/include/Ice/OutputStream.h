@@ -413,9 +413,17 @@ namespace Ice
         template<typename T> void write(const T* begin, const T* end)
         {
             writeSize(static_cast<std::int32_t>(end - begin));
-            for (const T* p = begin; p != end; ++p)
+            if constexpr (HasWireLayout<T>::value)
             {
-                write(*p);
+                // The memory layout of the elements is their Slice encoding.
+                writeBlob(reinterpret_cast<const std::byte*>(begin), static_cast<size_t>(end - begin) * sizeof(T));
+            }
+            else
+            {
+                for (const T* p = begin; p != end; ++p)
+                {
+                    write(*p);
+                }
             }
         }
 
@@ -51,6 +51,16 @@ namespace Ice
     /// @see InitializationData::pluginFactories
     ICE_API PluginFactory wsPluginFactory();
 
+#if (!defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)) || defined(ICE_DOXYGEN)
+    /// Returns the factory for the shared memory transport plug-in, IceSHM. This transport connects processes on the
+    /// same host through ring buffers in shared memory.
+    /// @return The factory for the IceSHM plug-in.
+    /// @remark The IceSHM plug-in isn't loaded by default. You load it by adding this factory to the plug-in factories
+    /// of the communicator, or by setting `Ice.Plugin.IceSHM=Ice:createIceSHM` with the Ice shared library.
+    /// @see InitializationData::pluginFactories
+    ICE_API PluginFactory shmPluginFactory();
+#endif
+
 #if (defined(__APPLE__) && TARGET_OS_IPHONE != 0) || defined(ICE_DOXYGEN)
     /// Returns the factory for the iAP transport plug-in, IceIAP.
     /// @return The factory for the IceIAP plug-in.
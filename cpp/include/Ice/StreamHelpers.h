@@ -7,6 +7,7 @@
 #include "OutputStream.h"
 #include "StringConverter.h"
 
+#include <cstring>
 #include <iterator>
 #include <ostream>
 
@@ -166,7 +167,9 @@ namespace Ice
     {
         static void write(OutputStream* stream, std::string_view v) { stream->write(v); }
 
-        // No read: we marshal string views but unmarshal strings.
+        // Used for string parameters with the cpp:view metadata.
+        static void read(InputStream* stream, std::string_view& v) { stream->read(v); }
+
         // No print: we only print fields.
     };
 
@@ -255,22 +258,46 @@ namespace Ice
 
     template<typename T> struct StreamHelper<T, StreamHelperCategorySequence>
     {
+        // A vector of structs whose memory layout is their Slice encoding is marshaled with a single copy.
+        static constexpr bool bulkCopy = HasWireLayout<typename T::value_type>::value &&
+                                         std::is_same_v<T, std::vector<typename T::value_type>>;
+
         static void write(OutputStream* stream, const T& v)
         {
-            stream->writeSize(static_cast<std::int32_t>(v.size()));
-            for (const auto& element : v)
+            if constexpr (bulkCopy)
             {
-                stream->write(element);
+                stream->write(v.data(), v.data() + v.size());
+            }
+            else
+            {
+                stream->writeSize(static_cast<std::int32_t>(v.size()));
+                for (const auto& element : v)
+                {
+                    stream->write(element);
+                }
             }
         }
 
         static void read(InputStream* stream, T& v)
         {
             std::int32_t sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
-            T(static_cast<size_t>(sz)).swap(v);
-            for (auto& element : v)
+            if constexpr (bulkCopy)
             {
-                stream->read(element);
+                const std::byte* bytes;
+                stream->readBlob(bytes, static_cast<size_t>(sz) * sizeof(typename T::value_type));
+                v.resize(static_cast<size_t>(sz));
+                if (sz > 0)
+                {
+                    std::memcpy(v.data(), bytes, static_cast<size_t>(sz) * sizeof(typename T::value_type));
+                }
+            }
+            else
+            {
+                T(static_cast<size_t>(sz)).swap(v);
+                for (auto& element : v)
+                {
+                    stream->read(element);
+                }
             }
         }
 
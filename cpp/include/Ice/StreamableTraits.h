@@ -5,8 +5,10 @@
 
 #include "ValueF.h"
 
+#include <cstddef>
 #include <optional>
 #include <string_view>
+#include <type_traits>
 
 namespace Ice
 {
@@ -116,6 +118,7 @@ namespace Ice
     /// @tparam Enabler A type used to enable a partial specialization for several types. It should not be used in the
     /// partial specialization itself.
     /// @remark Streamable traits for enumeration types provide two additional traits: `minValue` and `maxValue`.
+    /// Streamable traits for structures provide an additional trait: `wireLayout`.
     /// @headerfile Ice/Ice.h
     template<typename T, typename Enabler = void> struct StreamableTraits
     {
@@ -282,6 +285,27 @@ namespace Ice
 
     template<typename T, StreamHelperCategory st> struct StreamHelper;
 
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    inline constexpr bool nativeLittleEndian = true;
+#else
+    inline constexpr bool nativeLittleEndian = false;
+#endif
+
+    /// Determines whether the memory layout of a struct is its Slice encoding, which allows the streams to marshal and
+    /// unmarshal a sequence of such structs as a single block of bytes. slice2cpp sets the wireLayout trait of the
+    /// structs whose data members are all fixed-size integer or floating point types, or such structs; the struct
+    /// must also be trivially copyable, have no padding, and the target must be little-endian.
+    template<typename T, typename Enabler = void> struct HasWireLayout : std::false_type
+    {
+    };
+
+    template<typename T> struct HasWireLayout<T, std::enable_if_t<StreamableTraits<T>::wireLayout>>
+        : std::bool_constant<
+              nativeLittleEndian && std::is_trivially_copyable_v<T> &&
+              sizeof(T) == static_cast<std::size_t>(StreamableTraits<T>::minWireSize)>
+    {
+    };
+
     /// @endcond
 
     /// @private
@@ -10,6 +10,7 @@
 #include "IceGrid/Registry.h"
 #include "IceGrid/Session.h"
 #include "IceGrid/UserAccountMapper.h"
+#include "LocatorCache.h"
 #include "PluginFacade.h"
 
 #endif
@@ -0,0 +1,26 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICEGRID_LOCATOR_CACHE_H
+#define ICEGRID_LOCATOR_CACHE_H
+
+#include "Ice/Ice.h"
+#include "IceGrid/Registry.h"
+
+namespace IceGrid
+{
+    /// Resolves object adapters and well-known objects with bulk requests to the IceGrid locator, and adds the
+    /// resolved endpoints and proxies to the locator cache of the communicator. The indirect proxies that use this
+    /// locator then don't need to call the locator when they establish their connection. The adapters of the resolved
+    /// well-known objects are resolved as well. This function has no effect with a registry that doesn't support bulk
+    /// requests.
+    /// @param locator The IceGrid locator.
+    /// @param adapterIds The IDs of the object adapters and replica groups to resolve.
+    /// @param objectIds The identities of the well-known objects to resolve.
+    /// @headerfile IceGrid/IceGrid.h
+    ICEGRID_API void prefetchLocatorCache(
+        const LocatorPrx& locator,
+        const Ice::StringSeq& adapterIds,
+        const Ice::IdentitySeq& objectIds);
+}
+
+#endif
@@ -2,13 +2,17 @@
 
 #include "DataElementI.h"
 #include "CallbackExecutor.h"
+#include "DeltaEncoding.h"
+#include "HistoryStore.h"
 #include "Ice/Ice.h"
 #include "Instance.h"
 #include "NodeI.h"
+#include "SampleBatcher.h"
 #include "TopicI.h"
 #include "TraceUtil.h"
 
 #include <algorithm>
+#include <limits>
 #include <set>
 #include <stdexcept>
 
@@ -31,6 +35,27 @@ namespace
             .value = sample->encode(communicator)};
     }
 
+    // Returns the record of a published sample in the history store. A partial update is stored resolved to a full
+    // update: the records are read newest first when initializing a reader, without the base of the partial update.
+    // The key is only stored if the sample was published with a key, which isn't the case for single-key writers.
+    DataSample toStoredSample(
+        const shared_ptr<Key>& key,
+        const shared_ptr<Sample>& sample,
+        const CommunicatorPtr& communicator)
+    {
+        // The key ID of a stored sample tells whether the sample has a key: the samples of a single-key writer are
+        // stored without their key. The encoded key can't tell, a key can be encoded with no bytes.
+        const bool partialUpdate = sample->event == DataStorm::SampleEvent::PartialUpdate;
+        return DataSample{
+            .id = sample->id,
+            .keyId = key ? 1 : 0,
+            .keyValue = key ? key->encode(communicator) : ByteSeq{},
+            .timestamp = chrono::time_point_cast<chrono::microseconds>(sample->timestamp).time_since_epoch().count(),
+            .tag = 0,
+            .event = partialUpdate ? DataStorm::SampleEvent::Update : sample->event,
+            .value = partialUpdate ? sample->encodeValue(communicator) : sample->encode(communicator)};
+    }
+
     void cleanOldSamples(
         deque<shared_ptr<Sample>>& samples,
         const chrono::time_point<chrono::system_clock>& now,
@@ -46,6 +71,20 @@ namespace
             samples.erase(samples.begin(), p);
         }
     }
+
+    // Same as cleanOldSamples for a writer history: the writer timestamps its samples when it publishes them, so the
+    // stale samples are at the front of the history and the trimming doesn't scan the whole history.
+    void trimOldSamples(
+        deque<shared_ptr<Sample>>& samples,
+        const chrono::time_point<chrono::system_clock>& now,
+        int lifetime)
+    {
+        chrono::time_point<chrono::system_clock> staleTime = now - chrono::milliseconds(lifetime);
+        while (!samples.empty() && samples.front()->timestamp < staleTime)
+        {
+            samples.pop_front();
+        }
+    }
 }
 
 DataElementI::DataElementI(TopicI* parent, string name, int64_t id, const DataStorm::Config& config)
@@ -253,13 +292,18 @@ DataElementI::attachKey(
     const string& name,
     int priority)
 {
-    // No locking necessary, called by the session with the mutex locked
+    // Called by the session with the topic mutex locked.
+    lock_guard<mutex> forwardLock(_forwardMutex);
 
     ListenerKey listenerKey{.session = session, .facet = facet};
     auto p = _listeners.find(listenerKey);
     if (p == _listeners.end())
     {
-        p = _listeners.emplace(std::move(listenerKey), Listener{std::move(prx), facet}).first;
+        p = _listeners
+                .emplace(
+                    std::move(listenerKey),
+                    Listener{std::move(prx), facet, session->deltaEncoding(), session->getSampleBatcher()})
+                .first;
     }
 
     bool added = false;
@@ -278,6 +322,7 @@ DataElementI::attachKey(
         {
             subscriber->keys.insert(key);
         }
+        indexListener(p->second);
 
         if (_traceLevels->data > 1)
         {
@@ -296,6 +341,7 @@ DataElementI::attachKey(
         notifyListenerWaiters();
         return true;
     }
+    indexListener(p->second);
     return false;
 }
 
@@ -308,7 +354,8 @@ DataElementI::detachKey(
     const string& facet,
     bool unsubscribe)
 {
-    // No locking necessary, called by the session with the mutex locked
+    // Called by the session with the topic mutex locked.
+    lock_guard<mutex> forwardLock(_forwardMutex);
     auto p = _listeners.find({session, facet});
     if (p == _listeners.end())
     {
@@ -353,9 +400,15 @@ DataElementI::detachKey(
             }
             if (p->second.remove(topicId, elementId))
             {
+                unindexListener(p->second);
                 _listeners.erase(p);
+                p = _listeners.end();
             }
         }
+        if (p != _listeners.end())
+        {
+            indexListener(p->second);
+        }
 
         if (_traceLevels->data > 1)
         {
@@ -390,12 +443,17 @@ DataElementI::attachFilter(
     const string& name,
     int priority)
 {
-    // No locking necessary, called by the session with the mutex locked
+    // Called by the session with the topic mutex locked.
+    lock_guard<mutex> forwardLock(_forwardMutex);
     ListenerKey listenerKey{.session = session, .facet = facet};
     auto p = _listeners.find(listenerKey);
     if (p == _listeners.end())
     {
-        p = _listeners.emplace(std::move(listenerKey), Listener{std::move(prx), facet}).first;
+        p = _listeners
+                .emplace(
+                    std::move(listenerKey),
+                    Listener{std::move(prx), facet, session->deltaEncoding(), session->getSampleBatcher()})
+                .first;
     }
 
     // Negate the element ID for internal storage — filter subscriptions use negative IDs to distinguish them from
@@ -417,6 +475,7 @@ DataElementI::attachFilter(
         {
             subscriber->keys.insert(key);
         }
+        indexListener(p->second);
 
         if (_traceLevels->data > 1)
         {
@@ -435,6 +494,7 @@ DataElementI::attachFilter(
         notifyListenerWaiters();
         return true;
     }
+    indexListener(p->second);
     return false;
 }
 
@@ -448,7 +508,8 @@ DataElementI::detachFilter(
     bool unsubscribe)
 {
     assert(filterId < 0);
-    // No locking necessary, called by the session with the mutex locked
+    // Called by the session with the topic mutex locked.
+    lock_guard<mutex> forwardLock(_forwardMutex);
     auto p = _listeners.find({session, facet});
     if (p == _listeners.end())
     {
@@ -478,9 +539,15 @@ DataElementI::detachFilter(
             }
             if (p->second.remove(topicId, filterId))
             {
+                unindexListener(p->second);
                 _listeners.erase(p);
+                p = _listeners.end();
             }
         }
+        if (p != _listeners.end())
+        {
+            indexListener(p->second);
+        }
 
         if (_traceLevels->data > 1)
         {
@@ -690,6 +757,70 @@ DataElementI::removeConnectedKey(const shared_ptr<Key>& key, const shared_ptr<Su
     return false;
 }
 
+void
+DataElementI::indexListener(Listener& listener)
+{
+    // A subscriber without keys matches any key.
+    bool wildcard = false;
+    set<shared_ptr<Key>> keys;
+    for (const auto& [_, subscriber] : listener.subscribers)
+    {
+        if (subscriber->keys.empty())
+        {
+            wildcard = true;
+            break;
+        }
+        keys.insert(subscriber->keys.begin(), subscriber->keys.end());
+    }
+    if (wildcard)
+    {
+        keys.clear();
+    }
+
+    if (wildcard == listener.wildcard && keys == listener.indexedKeys)
+    {
+        return;
+    }
+
+    unindexListener(listener);
+    if (wildcard)
+    {
+        _wildcardListeners.insert(&listener);
+    }
+    else
+    {
+        for (const auto& key : keys)
+        {
+            _listenersByKey[key].insert(&listener);
+        }
+    }
+    listener.wildcard = wildcard;
+    listener.indexedKeys = std::move(keys);
+}
+
+void
+DataElementI::unindexListener(Listener& listener)
+{
+    if (listener.wildcard)
+    {
+        _wildcardListeners.erase(&listener);
+    }
+    for (const auto& key : listener.indexedKeys)
+    {
+        auto p = _listenersByKey.find(key);
+        if (p != _listenersByKey.end())
+        {
+            p->second.erase(&listener);
+            if (p->second.empty())
+            {
+                _listenersByKey.erase(p);
+            }
+        }
+    }
+    listener.wildcard = false;
+    listener.indexedKeys.clear();
+}
+
 void
 DataElementI::notifyListenerWaiters() const
 {
@@ -702,7 +833,10 @@ DataElementI::disconnect()
     map<ListenerKey, Listener> listeners;
     {
         unique_lock<mutex> lock(_parent->_mutex);
+        lock_guard<mutex> forwardLock(_forwardMutex);
         listeners.swap(_listeners);
+        _listenersByKey.clear();
+        _wildcardListeners.clear();
         _parent->decListenerCount(_listenerCount);
         _listenerCount = 0;
         notifyListenerWaiters();
@@ -737,6 +871,12 @@ DataElementI::forward(const ByteSeq& inParams, const Current& current) const
         // If we are forwarding a sample, check whether at least one of the listeners is interested in it.
         if (!_sample || listener.matchOne(_sample, false))
         {
+            // Send the samples batched for the peer session first, the peer must receive the calls in order.
+            if (listener.batcher)
+            {
+                listener.batcher->flush();
+            }
+
             // Forward the call using the listener's session proxy. We don't need to wait for the result.
             listener.proxy
                 ->ice_invokeAsync(current.operation, current.mode, inParams, nullptr, nullptr, nullptr, current.ctx);
@@ -1121,7 +1261,7 @@ DataReaderI::queue(
         // let a following partial update resolve for a key the application last saw removed. This is strictly better
         // than the pre-fix crash; distinguishing the two states would need a remove tombstone and isn't worth it.
         if (sample->event != DataStorm::SampleEvent::PartialUpdate && sample->event != DataStorm::SampleEvent::Remove &&
-            _lastByKey.find(sample->key) == _lastByKey.end())
+            !sample->deltaEncoded && _lastByKey.find(sample->key) == _lastByKey.end())
         {
             try
             {
@@ -1136,12 +1276,67 @@ DataReaderI::queue(
                 // Ignore, the sample was discarded anyway.
             }
         }
+
+        // The writer's next delta encoded update of the key can be computed against the discarded sample: keep it,
+        // or the reader drops the key's updates until the next full value. The value of a full sample doesn't need to
+        // be decoded to serve as a base, see decodeDelta.
+        try
+        {
+            if ((sample->event == DataStorm::SampleEvent::Add || sample->event == DataStorm::SampleEvent::Update) &&
+                (!sample->deltaEncoded || resolveDelta(sample)))
+            {
+                _discardedByKey[sample->key] = sample;
+            }
+            else
+            {
+                _discardedByKey.erase(sample->key);
+            }
+        }
+        catch (const std::exception&)
+        {
+            _discardedByKey.erase(sample->key);
+        }
         return;
     }
 
     if (!sample->hasValue())
     {
-        if (sample->event == DataStorm::SampleEvent::PartialUpdate)
+        if (sample->deltaEncoded)
+        {
+            // A delta encoded update is resolved against the writer's sample the delta was computed against. If this
+            // reader missed this sample, drop the update: the key is updated again by the next full value from the
+            // writer. The first drop of a key is reported with a warning, and the count of drops once the key is
+            // updated again.
+            try
+            {
+                if (!resolveDelta(sample))
+                {
+                    if (_droppedDeltasByKey[sample->key]++ == 0)
+                    {
+                        Warning out(_traceLevels->logger);
+                        out << this << ": dropping the delta encoded updates of key '" << sample->key
+                            << "' until its next full value: the reader didn't receive the value they are computed "
+                            << "against";
+                    }
+                    else if (_traceLevels->data > 0)
+                    {
+                        Trace out(_traceLevels->logger, _traceLevels->dataCat);
+                        out << this << ": discarded delta encoded sample " << sample->id
+                            << ": no matching base value for the key";
+                    }
+                    return;
+                }
+                sample->decode(_parent->instance()->getCommunicator());
+            }
+            catch (const std::exception& ex)
+            {
+                Warning out(_traceLevels->logger);
+                out << "dropped sample " << sample->id << ": the delta encoded value could not be decoded:\n"
+                    << ex.what();
+                return;
+            }
+        }
+        else if (sample->event == DataStorm::SampleEvent::PartialUpdate)
         {
             auto p = _lastByKey.find(sample->key);
             if (p == _lastByKey.end() || !p->second->hasValue())
@@ -1199,6 +1394,21 @@ DataReaderI::queue(
     {
         _lastByKey[sample->key] = sample;
     }
+    if (!_discardedByKey.empty())
+    {
+        _discardedByKey.erase(sample->key);
+    }
+    if (!_droppedDeltasByKey.empty())
+    {
+        auto p = _droppedDeltasByKey.find(sample->key);
+        if (p != _droppedDeltasByKey.end())
+        {
+            Warning out(_traceLevels->logger);
+            out << this << ": key '" << sample->key << "' is up to date again, " << p->second
+                << " delta encoded updates were dropped";
+            _droppedDeltasByKey.erase(p);
+        }
+    }
 
     if (_onSamples)
     {
@@ -1244,6 +1454,19 @@ DataReaderI::queue(
     _parent->_cond.notify_all();
 }
 
+bool
+DataReaderI::resolveDelta(const shared_ptr<Sample>& sample) const
+{
+    auto communicator = _parent->instance()->getCommunicator();
+    auto p = _discardedByKey.find(sample->key);
+    if (p != _discardedByKey.end() && decodeDelta(communicator, p->second, sample))
+    {
+        return true;
+    }
+    auto q = _lastByKey.find(sample->key);
+    return q != _lastByKey.end() && q->second->hasValue() && decodeDelta(communicator, q->second, sample);
+}
+
 void
 DataReaderI::onSamples(
     function<void(const vector<shared_ptr<Sample>>&)> init,
@@ -1305,12 +1528,39 @@ DataWriterI::DataWriterI(TopicWriterI* topic, string name, int64_t id, const Dat
       _subscribers{uncheckedCast<DataStormContract::SubscriberSessionPrx>(_forwarder)}
 {
     _config->priority = config.priority;
+    // With an interval of 1, every update is a full value.
+    _deltaKeyframeInterval = config.deltaKeyframeInterval.value_or(0) > 1 ? *config.deltaKeyframeInterval : 0;
+
+    // A named writer that keeps a history persists it in the node's history store, if any. The history is identified
+    // by the topic and writer names, so a writer created again with the same names, for example after a restart of
+    // the node, restores it.
+    auto historyStore = topic->instance()->getHistoryStore();
+    if (historyStore && !_name.empty() && (!_config->sampleCount || *_config->sampleCount != 0))
+    {
+        string historyName = topic->getName() + '\0' + _name;
+        if (!historyStore->isValidName(historyName))
+        {
+            Warning out(_traceLevels->logger);
+            out << "the names of topic '" << topic->getName() << "' and writer '" << _name
+                << "' are too long for the history store, the writer keeps its history in memory";
+        }
+        else
+        {
+            _historyStore = std::move(historyStore);
+            _historyName = std::move(historyName);
+        }
+    }
 }
 
 void
 DataWriterI::publish(const shared_ptr<Key>& key, const shared_ptr<Sample>& sample)
 {
-    lock_guard<mutex> lock(_parent->_mutex);
+    // Publishing on this writer is serialized by _publishMutex, so only the update of the history requires the topic
+    // lock. The partial update resolution and the marshaling of the sample, which both run application code, are done
+    // without holding the topic lock, and so is the sending of the sample: the writers of a topic send their samples
+    // concurrently, and each writer sends its samples in order. _lastByKey is only updated by publish, with both
+    // locks held, so it can be read here with just _publishMutex.
+    lock_guard<mutex> publishLock(_publishMutex);
     if (sample->event == DataStorm::SampleEvent::PartialUpdate)
     {
         assert(!sample->hasValue());
@@ -1326,34 +1576,143 @@ DataWriterI::publish(const shared_ptr<Key>& key, const shared_ptr<Sample>& sampl
             // can't fire here today, but both sides consume _lastByKey with identical semantics.
             throw std::logic_error("cannot apply a partial update to a key that has no value");
         }
-        _parent->getUpdater(sample->tag)(p->second, sample, _parent->instance()->getCommunicator());
+
+        auto updater = [&]
+        {
+            lock_guard<mutex> lock(_parent->_mutex);
+            return _parent->getUpdater(sample->tag);
+        }();
+        updater(p->second, sample, _parent->instance()->getCommunicator());
     }
 
+    // The sample ids only need to be unique and increasing for the samples of a writer.
     sample->id = ++_parent->_nextSampleId;
     sample->timestamp = chrono::system_clock::now();
+    // Marshal the value now, the sample caches it for send.
+    const auto& encoded = sample->encode(_parent->instance()->getCommunicator());
 
-    if (_traceLevels->data > 2)
+    // Encode an update as a delta against the last value of the key, unless the key's full value is due. The delta
+    // identifies the sample it's computed against: a reader whose value for the key isn't this sample drops it.
+    // A partial update also depends on the previous value of the key, it doesn't restart the interval.
+    Ice::ByteSeq delta;
+    if (_deltaKeyframeInterval > 0 && sample->event == DataStorm::SampleEvent::PartialUpdate)
     {
-        Trace out(_traceLevels->logger, _traceLevels->dataCat);
-        out << this << ": publishing sample " << sample->id << " listeners=" << _listenerCount;
+        auto p = _lastByKey.find(key);
+        if (p != _lastByKey.end())
+        {
+            sample->deltaCount = p->second->deltaCount + 1;
+        }
+    }
+    else if (_deltaKeyframeInterval > 0 && sample->event == DataStorm::SampleEvent::Update)
+    {
+        auto p = _lastByKey.find(key);
+        if (p != _lastByKey.end() && p->second->hasValue() && p->second->deltaCount + 1 < _deltaKeyframeInterval)
+        {
+            auto communicator = _parent->instance()->getCommunicator();
+            const auto& base = p->second;
+            delta = encodeDelta(
+                communicator,
+                base->id,
+                base->event == DataStorm::SampleEvent::PartialUpdate ? base->encodeValue(communicator)
+                                                                     : base->encode(communicator),
+                encoded);
+            if (!delta.empty())
+            {
+                sample->deltaCount = base->deltaCount + 1;
+            }
+        }
     }
-    send(key, sample);
 
-    // The per-key base for partial updates is maintained even when the element keeps no history (sampleCount == 0).
-    // A remove clears the base: the key has no value anymore, so a later partial update for the key has no base to
-    // resolve against and is discarded.
-    if (sample->event == DataStorm::SampleEvent::Remove)
+    const bool clearHistory =
+        _config->clearHistory &&
+        (*_config->clearHistory == ClearHistoryPolicy::OnAll ||
+         (sample->event == DataStorm::SampleEvent::Add && *_config->clearHistory == ClearHistoryPolicy::OnAdd) ||
+         (sample->event == DataStorm::SampleEvent::Remove && *_config->clearHistory == ClearHistoryPolicy::OnRemove) ||
+         (sample->event != DataStorm::SampleEvent::PartialUpdate &&
+          *_config->clearHistory == ClearHistoryPolicy::OnAllExceptPartialUpdate));
+
+    int64_t oldestStoredId = 0;
+    if (_historyStore)
     {
-        _lastByKey.erase(key);
+        // Apply the history policies to the stored history, as they are applied below to the in-memory history: the
+        // oldest stored samples are removed, and the sample is added. The update is queued before locking the topic
+        // mutex, and the store writes it asynchronously with the updates of the other writers. The store reads
+        // include the queued updates.
+        size_t eraseCount = 0;
+        if (clearHistory)
+        {
+            eraseCount = _storedSamples.size();
+        }
+        else
+        {
+            if (_config->sampleLifetime && *_config->sampleLifetime > 0)
+            {
+                auto staleTime = sample->timestamp - chrono::milliseconds(*_config->sampleLifetime);
+                while (eraseCount < _storedSamples.size() && _storedSamples[eraseCount].second < staleTime)
+                {
+                    ++eraseCount;
+                }
+            }
+
+            if (_config->sampleCount && *_config->sampleCount > 0)
+            {
+                while (_storedSamples.size() - eraseCount + 1 > static_cast<size_t>(*_config->sampleCount))
+                {
+                    ++eraseCount;
+                }
+            }
+        }
+
+        vector<int64_t> erase;
+        erase.reserve(eraseCount);
+        for (size_t i = 0; i < eraseCount; ++i)
+        {
+            erase.push_back(_storedSamples[i].first);
+        }
+        _historyStore->update(
+            _historyName,
+            toStoredSample(key, sample, _parent->instance()->getCommunicator()),
+            std::move(erase));
+
+        _storedSamples.erase(_storedSamples.begin(), _storedSamples.begin() + static_cast<ptrdiff_t>(eraseCount));
+        _storedSamples.emplace_back(sample->id, sample->timestamp);
+        oldestStoredId = _storedSamples.front().first;
     }
-    else
+
+    {
+        lock_guard<mutex> lock(_parent->_mutex);
+        _oldestStoredId = oldestStoredId;
+
+        // The per-key base for partial updates is maintained even when the element keeps no history
+        // (sampleCount == 0). A remove clears the base: the key has no value anymore, so a later partial update for
+        // the key has no base to resolve against and is discarded.
+        if (sample->event == DataStorm::SampleEvent::Remove)
+        {
+            _lastByKey.erase(key);
+        }
+        else
+        {
+            _lastByKey[key] = sample;
+        }
+        addToHistory(sample, clearHistory);
+    }
+
+    // The history is updated first: a listener attached before the send gets the sample with its initialization
+    // samples, and ignores it when it's sent again, see SubscriberSessionI::s.
+    if (_traceLevels->data > 2)
     {
-        _lastByKey[key] = sample;
+        Trace out(_traceLevels->logger, _traceLevels->dataCat);
+        out << this << ": publishing sample " << sample->id;
     }
+    send(sample, std::move(delta));
+}
 
+void
+DataWriterI::addToHistory(const shared_ptr<Sample>& sample, bool clearHistory)
+{
     if (_config->sampleLifetime && *_config->sampleLifetime > 0)
     {
-        cleanOldSamples(_samples, sample->timestamp, *_config->sampleLifetime);
+        trimOldSamples(_samples, sample->timestamp, *_config->sampleLifetime);
     }
 
     if (_config->sampleCount)
@@ -1371,17 +1730,22 @@ DataWriterI::publish(const shared_ptr<Key>& key, const shared_ptr<Sample>& sampl
         }
     }
 
-    if (_config->clearHistory &&
-        (*_config->clearHistory == ClearHistoryPolicy::OnAll ||
-         (sample->event == DataStorm::SampleEvent::Add && *_config->clearHistory == ClearHistoryPolicy::OnAdd) ||
-         (sample->event == DataStorm::SampleEvent::Remove && *_config->clearHistory == ClearHistoryPolicy::OnRemove) ||
-         (sample->event != DataStorm::SampleEvent::PartialUpdate &&
-          *_config->clearHistory == ClearHistoryPolicy::OnAllExceptPartialUpdate)))
+    if (clearHistory)
     {
         _samples.clear();
     }
     assert(sample->key);
     _samples.push_back(sample);
+
+    // With a history store, only the most recent samples are kept in memory. The samples aren't evicted while a
+    // session reads the older samples from the store, see prefetchHistory.
+    if (_historyStore && _historyPins == 0)
+    {
+        while (_samples.size() > static_cast<size_t>(_parent->instance()->getHistoryCacheSize()))
+        {
+            _samples.pop_front();
+        }
+    }
 }
 
 KeyDataReaderI::KeyDataReaderI(
@@ -1470,6 +1834,62 @@ KeyDataWriterI::KeyDataWriterI(
     : DataWriterI(topic, std::move(name), id, config),
       _keys(keys)
 {
+    if (_historyStore)
+    {
+        // Restore the history stored by a previous instance of this writer, and the per-key bases for partial
+        // updates. Keys whose last sample is no longer in the history don't get a base back.
+        size_t cacheSize = static_cast<size_t>(_parent->instance()->getHistoryCacheSize());
+        if (_config->sampleCount && *_config->sampleCount > 0)
+        {
+            cacheSize = min(cacheSize, static_cast<size_t>(*_config->sampleCount));
+        }
+
+        int64_t lastId = 0;
+        _historyStore->load(
+            _historyName,
+            [&](DataSample& record)
+            {
+                // As in publish, the base of a single-key writer is stored under a null publish key.
+                const bool hasKey = record.keyId != 0;
+                auto sample = restoreSample(record);
+                if (!sample)
+                {
+                    return;
+                }
+
+                if (sample->event == DataStorm::SampleEvent::Remove)
+                {
+                    _lastByKey.erase(hasKey ? sample->key : nullptr);
+                }
+                else
+                {
+                    _lastByKey[hasKey ? sample->key : nullptr] = sample;
+                }
+
+                _storedSamples.emplace_back(sample->id, sample->timestamp);
+                _samples.push_back(sample);
+                if (_samples.size() > cacheSize)
+                {
+                    _samples.pop_front();
+                }
+                lastId = sample->id;
+            });
+
+        _oldestStoredId = _storedSamples.empty() ? 0 : _storedSamples.front().first;
+
+        // The samples published from now on must have greater IDs than the restored samples.
+        int64_t nextSampleId = _parent->_nextSampleId;
+        while (nextSampleId < lastId && !_parent->_nextSampleId.compare_exchange_weak(nextSampleId, lastId))
+        {
+        }
+
+        if (_traceLevels->data > 0 && !_storedSamples.empty())
+        {
+            Trace out(_traceLevels->logger, _traceLevels->dataCat);
+            out << this << ": restored " << _storedSamples.size() << " samples from the history store";
+        }
+    }
+
     if (_traceLevels->data > 0)
     {
         Trace out(_traceLevels->logger, _traceLevels->dataCat);
@@ -1487,6 +1907,8 @@ KeyDataWriterI::destroyImpl()
     }
     try
     {
+        // Forwarded with _forwardMutex locked, the writer can be sending a sample concurrently.
+        lock_guard<mutex> forwardLock(_forwardMutex);
         _forwarder->detachElements(_parent->getId(), {_keys.empty() ? -_id : _id});
     }
     catch (const std::exception&)
@@ -1496,6 +1918,15 @@ KeyDataWriterI::destroyImpl()
     _parent->remove(shared_from_this(), _keys);
 }
 
+void
+KeyDataWriterI::publish(const shared_ptr<Key>& key, const shared_ptr<Sample>& sample)
+{
+    // The history only holds samples with a key, set it before the sample is added to the history.
+    assert(key || _keys.size() == 1);
+    sample->key = key ? key : _keys[0];
+    DataWriterI::publish(key, sample);
+}
+
 void
 KeyDataWriterI::waitForReaders(int count) const
 {
@@ -1518,6 +1949,23 @@ KeyDataWriterI::getLast() const
 vector<shared_ptr<Sample>>
 KeyDataWriterI::getAll() const
 {
+    if (_historyStore)
+    {
+        // Only the most recent samples are in memory. The stored history includes them, and is read without locking
+        // the topic mutex.
+        vector<shared_ptr<Sample>> all;
+        _historyStore->load(
+            _historyName,
+            [&](DataSample& record)
+            {
+                if (auto sample = restoreSample(record))
+                {
+                    all.push_back(std::move(sample));
+                }
+            });
+        return all;
+    }
+
     unique_lock<mutex> lock(_parent->_mutex);
     vector<shared_ptr<Sample>> all(_samples.begin(), _samples.end());
     return all;
@@ -1674,36 +2122,67 @@ KeyDataWriterI::getSamples(
     // For each matching sample, add it to the source set and record the key it covers.
     vector<shared_ptr<Sample>> sources;
     set<shared_ptr<Key>> covered;
-    for (auto p = _samples.rbegin(); p != _samples.rend(); ++p)
+    auto visit = [&](const shared_ptr<Sample>& sample)
     {
-        if ((*p)->timestamp < staleTime)
+        if (sample->timestamp < staleTime)
         {
-            break;
+            return false;
         }
-        if ((*p)->id <= lastId)
+        if (sample->id <= lastId)
         {
-            break;
+            return false;
         }
 
-        if ((!key || key == (*p)->key) && (!sampleFilter || sampleFilter->match(*p)))
+        if ((!key || key == sample->key) && (!sampleFilter || sampleFilter->match(sample)))
         {
-            sources.push_back(*p);
-            covered.insert((*p)->key);
+            sources.push_back(sample);
+            covered.insert(sample->key);
             if (config->sampleCount && *config->sampleCount > 0 &&
                 static_cast<size_t>(*config->sampleCount) == sources.size())
             {
-                break;
+                return false;
             }
 
             if (config->clearHistory &&
                 (*config->clearHistory == ClearHistoryPolicy::OnAll ||
-                 ((*p)->event == DataStorm::SampleEvent::Add && *config->clearHistory == ClearHistoryPolicy::OnAdd) ||
-                 ((*p)->event == DataStorm::SampleEvent::Remove &&
+                 (sample->event == DataStorm::SampleEvent::Add && *config->clearHistory == ClearHistoryPolicy::OnAdd) ||
+                 (sample->event == DataStorm::SampleEvent::Remove &&
                   *config->clearHistory == ClearHistoryPolicy::OnRemove) ||
-                 ((*p)->event != DataStorm::SampleEvent::PartialUpdate &&
+                 (sample->event != DataStorm::SampleEvent::PartialUpdate &&
                   *config->clearHistory == ClearHistoryPolicy::OnAllExceptPartialUpdate)))
             {
-                break;
+                return false;
+            }
+        }
+        return true;
+    };
+
+    bool more = true;
+    for (auto p = _samples.rbegin(); more && p != _samples.rend(); ++p)
+    {
+        more = visit(*p);
+    }
+
+    if (more && _historyStore)
+    {
+        // Continue with the older samples, which are only in the history store. The session read them before locking
+        // the topic mutex, see prefetchHistory. They directly precede the samples in memory unless the history was
+        // trimmed since, and the samples removed from the store in the meantime are skipped. The stale samples of the
+        // writer are removed from the store on the next publish, skip them here.
+        if (_config->sampleLifetime && *_config->sampleLifetime > 0)
+        {
+            staleTime = max(staleTime, now - chrono::milliseconds(*_config->sampleLifetime));
+        }
+        int64_t beforeId = _samples.empty() ? numeric_limits<int64_t>::max() : _samples.front()->id;
+        if (_historyPrefetch && _historyPrefetch->beforeId == beforeId)
+        {
+            for (const auto& sample : _historyPrefetch->samples)
+            {
+                if (sample->timestamp < staleTime || sample->id <= lastId || sample->id < _oldestStoredId ||
+                    !visit(sample))
+                {
+                    break;
+                }
             }
         }
     }
@@ -1717,29 +2196,186 @@ KeyDataWriterI::getSamples(
 }
 
 void
-KeyDataWriterI::send(const shared_ptr<Key>& key, const shared_ptr<Sample>& sample) const
+KeyDataWriterI::prefetchHistory()
 {
-    assert(key || _keys.size() == 1);
+    if (!_historyStore)
+    {
+        return;
+    }
+
+    int64_t beforeId;
+    {
+        lock_guard<mutex> lock(_parent->_mutex);
+        ++_historyPins;
+        beforeId = _samples.empty() ? numeric_limits<int64_t>::max() : _samples.front()->id;
+        if (_historyPrefetch && _historyPrefetch->beforeId == beforeId)
+        {
+            return; // Already read by another session.
+        }
+    }
+
+    // The in-memory samples aren't evicted until releaseHistory is called, so the samples read here still directly
+    // precede them when the readers are attached.
+    auto prefetch = make_shared<HistoryPrefetch>();
+    prefetch->beforeId = beforeId;
+    _historyStore->forEach(
+        _historyName,
+        beforeId,
+        [&](DataSample& record)
+        {
+            if (auto sample = restoreSample(record))
+            {
+                prefetch->samples.push_back(std::move(sample));
+            }
+            return true;
+        });
+
+    lock_guard<mutex> lock(_parent->_mutex);
+    _historyPrefetch = std::move(prefetch);
+}
+
+void
+KeyDataWriterI::releaseHistory()
+{
+    // Called with the topic mutex locked.
+    if (_historyStore && --_historyPins == 0)
+    {
+        _historyPrefetch = nullptr;
+    }
+}
+
+shared_ptr<Sample>
+KeyDataWriterI::restoreSample(DataSample& record) const
+{
+    // A record without a key was stored by a single-key writer. Another writer with the same names but a different
+    // set of keys can't restore it.
+    auto communicator = getCommunicator();
+    shared_ptr<Key> key;
+    if (record.keyId != 0)
+    {
+        key = _parent->getKeyFactory()->decode(communicator, record.keyValue);
+    }
+    else if (_keys.size() == 1)
+    {
+        key = _keys[0];
+    }
+    else
+    {
+        return nullptr;
+    }
+    auto sample = _parent->getSampleFactory()->create(
+        "",
+        "",
+        record.id,
+        record.event,
+        key,
+        nullptr,
+        std::move(record.value),
+        record.timestamp);
+    sample->decode(communicator);
+    return sample;
+}
+
+void
+KeyDataWriterI::send(const shared_ptr<Sample>& sample, ByteSeq delta) const
+{
+    assert(sample->key);
+    lock_guard<mutex> forwardLock(_forwardMutex);
     _sample = sample;
-    _sample->key = key ? key : _keys[0];
-    _subscribers->s(_parent->getId(), _keys.empty() ? -_id : _id, toSample(sample, getCommunicator(), _keys.empty()));
+    DataSample dataSample = toSample(sample, getCommunicator(), _keys.empty());
+    if (!delta.empty())
+    {
+        _fullSample = dataSample;
+        dataSample.tag = deltaTag;
+        dataSample.value = std::move(delta);
+    }
+    _subscribers->s(_parent->getId(), _keys.empty() ? -_id : _id, dataSample);
     _sample = nullptr;
+    _fullSample = nullopt;
 }
 
 void
 KeyDataWriterI::forward(const ByteSeq& inParams, const Current& current) const
 {
-    for (const auto& [_, listener] : _listeners)
+    if (!_sample)
     {
-        // Forward the sample if the listener has at least one subscriber interested in the update. The key is
-        // always matched: a multi-key writer's sessions don't necessarily subscribe to every key of the writer,
-        // and an unmatched key's sample would be wasted bandwidth at best (the receiver never subscribed its id).
-        if (!_sample || listener.matchOne(_sample, true))
+        for (const auto& [_, listener] : _listeners)
         {
+            // Send the samples batched for the peer session first, the peer must receive the calls in order.
+            if (listener.batcher)
+            {
+                listener.batcher->flush();
+            }
+
             // Forward the call using the listener's session proxy. We don't need to wait for the result.
             listener.proxy
                 ->ice_invokeAsync(current.operation, current.mode, inParams, nullptr, nullptr, nullptr, current.ctx);
         }
+        return;
+    }
+
+    auto instance = _parent->instance();
+
+    // A delta encoded update is only sent to the listeners which accept it. The others get the full value, marshaled
+    // on first use.
+    ByteSeq fullParams;
+    auto getParams = [&](const auto& listener) -> const ByteSeq&
+    {
+        if (!_fullSample || listener.acceptsDelta())
+        {
+            return inParams;
+        }
+
+        if (fullParams.empty())
+        {
+            OutputStream out(instance->getCommunicator(), current.encoding);
+            out.startEncapsulation(current.encoding, nullopt);
+            out.writeAll(_parent->getId(), _keys.empty() ? -_id : _id, *_fullSample);
+            out.endEncapsulation();
+            out.finished(fullParams);
+        }
+        return fullParams;
+    };
+
+    auto forwardSample = [&](const auto& listener)
+    {
+        // Forward the sample if the listener has at least one subscriber interested in the update. The key is
+        // always matched: a multi-key writer's sessions don't necessarily subscribe to every key of the writer,
+        // and an unmatched key's sample would be wasted bandwidth at best (the receiver never subscribed its id).
+        if (!listener.matchOne(_sample, true))
+        {
+            return;
+        }
+
+        const ByteSeq& params = getParams(listener);
+
+        if (listener.batcher)
+        {
+            if (!listener.batchProxy)
+            {
+                listener.batchProxy = listener.proxy->ice_batchOneway();
+            }
+            if (listener.batcher->queue(*listener.batchProxy, current.operation, current.mode, params, current.ctx))
+            {
+                return;
+            }
+        }
+        listener.proxy
+            ->ice_invokeAsync(current.operation, current.mode, params, nullptr, nullptr, nullptr, current.ctx);
+    };
+
+    // Only the listeners registered with the sample's key or with any key can match the sample.
+    auto p = _listenersByKey.find(_sample->key);
+    if (p != _listenersByKey.end())
+    {
+        for (const auto* listener : p->second)
+        {
+            forwardSample(*listener);
+        }
+    }
+    for (const auto* listener : _wildcardListeners)
+    {
+        forwardSample(*listener);
     }
 }
 
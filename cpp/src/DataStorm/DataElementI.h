@@ -6,6 +6,8 @@
 #include "DataStorm/Contract.h"
 #include "DataStorm/InternalI.h"
 
+#include <algorithm>
+
 #if defined(__clang__)
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wshadow-field-in-constructor"
@@ -21,7 +23,9 @@ namespace DataStormI
     class TopicReaderI;
     class TopicWriterI;
     class CallbackExecutor;
+    class SampleBatcher;
     class TraceLevels;
+    class HistoryStore;
 
     // Base class for DataReaderI and DataWriterI.
     class DataElementI : public virtual DataElement, public std::enable_shared_from_this<DataElementI>
@@ -75,11 +79,30 @@ namespace DataStormI
 
         struct Listener
         {
-            Listener(DataStormContract::SessionPrx proxy, std::string facet)
+            Listener(
+                DataStormContract::SessionPrx proxy,
+                std::string facet,
+                bool deltaEncoding,
+                std::shared_ptr<SampleBatcher> batcher)
                 : proxy(
                       facet.empty() ? std::move(proxy)
-                                    : proxy->ice_facet<DataStormContract::SessionPrx>(std::move(facet)))
+                                    : proxy->ice_facet<DataStormContract::SessionPrx>(std::move(facet))),
+                  deltaEncoding(deltaEncoding),
+                  batcher(std::move(batcher))
+            {
+            }
+
+            /// Determines if the listener can be sent delta encoded updates: the peer session must support them, and
+            /// the subscribers must get every update of a key, which isn't the case with a sample filter.
+            ///
+            /// @return `true` if the listener can be sent delta encoded updates, otherwise false.
+            [[nodiscard]] bool acceptsDelta() const
             {
+                return deltaEncoding &&
+                       std::none_of(
+                           subscribers.begin(),
+                           subscribers.end(),
+                           [](const auto& subscriber) { return subscriber.second->sampleFilter != nullptr; });
             }
 
             /// Determines if any subscriber matches the given sample.
@@ -137,6 +160,16 @@ namespace DataStormI
 
             // The proxy to the peer session.
             DataStormContract::SessionPrx proxy;
+            // Whether the peer session accepts delta encoded updates.
+            bool deltaEncoding;
+            // The batcher of the session, or null if the writers don't batch samples.
+            std::shared_ptr<SampleBatcher> batcher;
+            // The batch oneway proxy to the peer session, created on first use to batch a sample.
+            mutable std::optional<DataStormContract::SessionPrx> batchProxy;
+            // The keys this listener is registered with in _listenersByKey, or true for wildcard if the listener is
+            // registered with _wildcardListeners instead.
+            std::set<std::shared_ptr<Key>> indexedKeys;
+            bool wildcard{false};
             // A map containing the data element subscribers, indexed by the topic ID and the element ID.
             std::map<std::pair<std::int64_t, std::int64_t>, std::shared_ptr<Subscriber>> subscribers;
         };
@@ -272,6 +305,12 @@ namespace DataStormI
             std::int64_t,
             const std::chrono::time_point<std::chrono::system_clock>&);
 
+        // Reads the samples of the element's history store that getSamples needs, before the session locks the topic
+        // mutex to attach elements. Called without the topic mutex locked. releaseHistory is called, with the topic
+        // mutex locked, once the elements are attached.
+        virtual void prefetchHistory() {}
+        virtual void releaseHistory() {}
+
         virtual void queue(
             const std::shared_ptr<Sample>&,
             int,
@@ -299,6 +338,10 @@ namespace DataStormI
 
         void notifyListenerWaiters() const;
         void disconnect();
+
+        // Updates the registration of the listener with the listener index after a change of its subscribers.
+        void indexListener(Listener&);
+        void unindexListener(Listener&);
         virtual void destroyImpl() = 0;
 
         const std::shared_ptr<TraceLevels> _traceLevels;
@@ -309,6 +352,10 @@ namespace DataStormI
 
         size_t _listenerCount{0};
         mutable std::shared_ptr<Sample> _sample;
+        // Serializes the calls forwarded to the listeners with the updates of the listeners, and protects _sample.
+        // The listeners are only updated with both the topic mutex and this mutex locked, always in this order, so
+        // they can be read with either one. A writer sends its samples with only this mutex locked.
+        mutable std::mutex _forwardMutex;
         DataStormContract::SessionPrx _forwarder;
         // A map containing the connected keys, these are keys attached to a peer key.
         // The map is indexed by the key, and the value is a vector of subscribers for the given key.
@@ -318,6 +365,12 @@ namespace DataStormI
         // implementation of forward utilizes the listener map to forward calls to the peer sessions.
         std::map<ListenerKey, Listener> _listeners;
 
+        // An index of _listeners used to forward a sample only to the listeners that can match its key: the listeners
+        // with a subscriber for a given key are registered with this key, and the listeners with a subscriber for any
+        // key are registered with _wildcardListeners. A listener is registered with one or the other.
+        std::map<std::shared_ptr<Key>, std::set<const Listener*>> _listenersByKey;
+        std::set<const Listener*> _wildcardListeners;
+
     private:
         virtual void forward(const Ice::ByteSeq&, const Ice::Current&) const;
 
@@ -374,11 +427,21 @@ namespace DataStormI
         // that can deliver the given key (a keyed peer under the key, or a filter/any-key peer under the null key).
         [[nodiscard]] bool hasLowerPriorityThanConnected(int priority, const std::shared_ptr<Key>& key) const;
 
+        // Resolves the value of a delta encoded sample against the sample of the key it was computed against, the
+        // last discarded or received sample of the key. Returns false if neither is this sample.
+        [[nodiscard]] bool resolveDelta(const std::shared_ptr<Sample>&) const;
+
         TopicReaderI* _parent;
 
         std::deque<std::shared_ptr<Sample>> _samples;
         // The last sample received for each key, used to resolve partial updates per key.
         std::map<std::shared_ptr<Key>, std::shared_ptr<Sample>> _lastByKey;
+        // The last sample of each key discarded by the discard policy since the last received sample of the key. A
+        // discarded sample can be the base of the writer's next delta encoded update of the key.
+        std::map<std::shared_ptr<Key>, std::shared_ptr<Sample>> _discardedByKey;
+        // The number of delta encoded updates of each key dropped since the last received sample of the key, because
+        // the reader didn't have the value they are computed against.
+        std::map<std::shared_ptr<Key>, int> _droppedDeltasByKey;
         int _instanceCount{0};
         DataStorm::DiscardPolicy _discardPolicy;
         std::chrono::time_point<std::chrono::system_clock> _lastSendTime;
@@ -393,13 +456,48 @@ namespace DataStormI
         void publish(const std::shared_ptr<Key>&, const std::shared_ptr<Sample>&) override;
 
     protected:
-        virtual void send(const std::shared_ptr<Key>&, const std::shared_ptr<Sample>&) const = 0;
+        // Adds the sample to the in-memory history, called with the topic mutex locked.
+        void addToHistory(const std::shared_ptr<Sample>&, bool);
+
+        // Sends the sample to the listeners. The delta, if not empty, is sent instead of the sample value. Called
+        // without the topic mutex locked.
+        virtual void send(const std::shared_ptr<Sample>&, Ice::ByteSeq) const = 0;
 
         TopicWriterI* _parent;
         DataStormContract::SubscriberSessionPrx _subscribers;
         std::deque<std::shared_ptr<Sample>> _samples;
         // The last sample published for each key, used to resolve partial updates per key. See DataReaderI::_lastByKey.
         std::map<std::shared_ptr<Key>, std::shared_ptr<Sample>> _lastByKey;
+        // Serializes the publishing of samples on this writer. Always locked before the topic mutex.
+        std::mutex _publishMutex;
+
+        // The store of the writer history, or null if the writer keeps its history only in memory. When set,
+        // _samples only holds the most recent samples of the history.
+        std::shared_ptr<HistoryStore> _historyStore;
+        // The name of the writer history in the history store: the topic name and the writer name.
+        std::string _historyName;
+        // The ID and timestamp of the samples in the history store, from the oldest to the newest. Only accessed with
+        // _publishMutex locked, or from the constructor.
+        std::deque<std::pair<std::int64_t, std::chrono::time_point<std::chrono::system_clock>>> _storedSamples;
+        // The ID of the oldest sample in the history store.
+        std::int64_t _oldestStoredId{0};
+
+        // The stored samples older than the in-memory samples, read by prefetchHistory.
+        struct HistoryPrefetch
+        {
+            // The ID of the oldest in-memory sample when the samples were read.
+            std::int64_t beforeId;
+            // The samples, from the newest to the oldest.
+            std::vector<std::shared_ptr<Sample>> samples;
+        };
+        std::shared_ptr<HistoryPrefetch> _historyPrefetch;
+        // The number of sessions attaching elements with the prefetched samples. The in-memory samples aren't evicted
+        // while it's not 0.
+        int _historyPins{0};
+
+        // The number of updates after which a key's full value is sent again, or 0 if updates aren't delta encoded.
+        // The number of delta encoded updates since the last full value is kept with the last sample of the key.
+        int _deltaKeyframeInterval;
     };
 
     class KeyDataReaderI final : public DataReaderI
@@ -439,6 +537,8 @@ namespace DataStormI
 
         void destroyImpl() final;
 
+        void publish(const std::shared_ptr<Key>&, const std::shared_ptr<Sample>&) final;
+
         void waitForReaders(int) const final;
         [[nodiscard]] bool hasReaders() const final;
 
@@ -454,11 +554,22 @@ namespace DataStormI
             std::int64_t,
             const std::chrono::time_point<std::chrono::system_clock>&) final;
 
+        void prefetchHistory() final;
+        void releaseHistory() final;
+
     private:
-        void send(const std::shared_ptr<Key>&, const std::shared_ptr<Sample>&) const final;
+        void send(const std::shared_ptr<Sample>&, Ice::ByteSeq) const final;
         void forward(const Ice::ByteSeq&, const Ice::Current&) const final;
 
+        // Creates a sample from its record in the history store, or returns null if the record doesn't belong to a
+        // key of this writer.
+        [[nodiscard]] std::shared_ptr<Sample> restoreSample(DataStormContract::DataSample&) const;
+
         const std::vector<std::shared_ptr<Key>> _keys;
+
+        // The sample being sent with its full value, when it's sent as a delta encoded update to the listeners which
+        // accept it. See forward.
+        mutable std::optional<DataStormContract::DataSample> _fullSample;
     };
 
     class FilteredDataReaderI final : public DataReaderI
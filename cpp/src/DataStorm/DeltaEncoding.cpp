@@ -0,0 +1,171 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DeltaEncoding.h"
+
+using namespace std;
+using namespace DataStormI;
+
+//
+// A delta is encoded as:
+// - the ID of the base sample, the size of the base value and a checksum of the value,
+// - the size of the value and the size of the suffix it shares with the base value,
+// - a sequence of (copy, literal) runs which rebuild the value up to the suffix: each run copies `copy` bytes of the
+//   base value at the current position, and then appends `literal` bytes from the delta.
+//
+// Copied bytes are read at the same position in the base value, which is what slightly different encodings of the
+// same type share. The suffix handles a change of size, for example an element added to a sequence.
+//
+namespace
+{
+    // The minimum number of equal bytes worth ending a literal run for: a run costs at least two bytes.
+    const size_t minCopySize = 8;
+
+    // 64-bit FNV-1a, to detect a base value that doesn't match the writer's base value: the reader re-encodes its
+    // decoded base value, which doesn't necessarily give the writer's bytes, for example with a custom encoder.
+    int64_t checksum(const Ice::ByteSeq& value)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (auto b : value)
+        {
+            hash ^= static_cast<uint8_t>(b);
+            hash *= 1099511628211ULL;
+        }
+        return static_cast<int64_t>(hash);
+    }
+}
+
+Ice::ByteSeq
+DataStormI::encodeDelta(
+    const Ice::CommunicatorPtr& communicator,
+    int64_t baseId,
+    const Ice::ByteSeq& base,
+    const Ice::ByteSeq& value)
+{
+    size_t suffix = 0;
+    while (suffix < base.size() && suffix < value.size() &&
+           base[base.size() - suffix - 1] == value[value.size() - suffix - 1])
+    {
+        ++suffix;
+    }
+    const size_t valueEnd = value.size() - suffix;
+    const size_t baseEnd = base.size() - suffix;
+    auto equalBytes = [&](size_t pos)
+    {
+        size_t count = 0;
+        while (pos + count < valueEnd && pos + count < baseEnd && value[pos + count] == base[pos + count])
+        {
+            ++count;
+        }
+        return count;
+    };
+
+    Ice::OutputStream out(communicator);
+    out.write(baseId);
+    out.write(static_cast<int32_t>(base.size()));
+    out.write(checksum(value));
+    out.writeSize(static_cast<int32_t>(value.size()));
+    out.writeSize(static_cast<int32_t>(suffix));
+
+    size_t pos = 0;
+    while (pos < valueEnd)
+    {
+        size_t copy = equalBytes(pos);
+        size_t literalEnd = pos + copy;
+        while (literalEnd < valueEnd)
+        {
+            size_t equal = equalBytes(literalEnd);
+            if (equal >= minCopySize || literalEnd + equal == valueEnd)
+            {
+                break;
+            }
+            literalEnd += equal + 1;
+        }
+        literalEnd = min(literalEnd, valueEnd);
+
+        out.writeSize(static_cast<int32_t>(copy));
+        out.writeSize(static_cast<int32_t>(literalEnd - pos - copy));
+        if (literalEnd > pos + copy)
+        {
+            out.writeBlob(&value[pos + copy], literalEnd - pos - copy);
+        }
+        pos = literalEnd;
+
+        if (out.b.size() >= value.size())
+        {
+            return {};
+        }
+    }
+
+    Ice::ByteSeq delta;
+    out.finished(delta);
+    return delta;
+}
+
+bool
+DataStormI::decodeDelta(
+    const Ice::CommunicatorPtr& communicator,
+    const shared_ptr<Sample>& base,
+    const shared_ptr<Sample>& sample)
+{
+    const Ice::ByteSeq& delta = sample->getEncodedValue();
+    Ice::InputStream in(communicator, delta);
+
+    // The base must be the writer's sample the delta was computed against.
+    int64_t baseId;
+    in.read(baseId);
+    if (base->id != baseId || base->session != sample->session || base->origin != sample->origin)
+    {
+        return false;
+    }
+
+    int32_t baseSize;
+    int64_t valueChecksum;
+    in.read(baseSize);
+    in.read(valueChecksum);
+    // The value of a base sample that isn't decoded is the encoded value sent by the writer.
+    Ice::ByteSeq baseValue = base->hasValue() ? base->encodeValue(communicator) : base->getEncodedValue();
+    if (baseValue.size() != static_cast<size_t>(baseSize))
+    {
+        return false;
+    }
+
+    auto valueSize = static_cast<size_t>(in.readSize());
+    auto suffix = static_cast<size_t>(in.readSize());
+    if (suffix > valueSize || suffix > baseValue.size())
+    {
+        return false;
+    }
+    const size_t valueEnd = valueSize - suffix;
+    const size_t baseEnd = baseValue.size() - suffix;
+
+    Ice::ByteSeq value;
+    value.reserve(valueSize);
+    while (value.size() < valueEnd)
+    {
+        auto copy = static_cast<size_t>(in.readSize());
+        auto literal = static_cast<size_t>(in.readSize());
+        const size_t pos = value.size();
+        if (copy + literal == 0 || pos + copy > baseEnd || pos + copy + literal > valueEnd)
+        {
+            return false;
+        }
+        value.insert(
+            value.end(),
+            baseValue.begin() + static_cast<ptrdiff_t>(pos),
+            baseValue.begin() + static_cast<ptrdiff_t>(pos + copy));
+        if (literal > 0)
+        {
+            const byte* literalBytes;
+            in.readBlob(literalBytes, literal);
+            value.insert(value.end(), literalBytes, literalBytes + literal);
+        }
+    }
+    value.insert(value.end(), baseValue.begin() + static_cast<ptrdiff_t>(baseEnd), baseValue.end());
+
+    if (checksum(value) != valueChecksum)
+    {
+        return false;
+    }
+    sample->setEncodedValue(std::move(value));
+    return true;
+}
@@ -0,0 +1,24 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef DATASTORM_DELTA_ENCODING_H
+#define DATASTORM_DELTA_ENCODING_H
+
+#include "DataStorm/InternalI.h"
+#include "Ice/Ice.h"
+
+namespace DataStormI
+{
+    // The tag of a delta encoded Update sample. The value of such a sample is a delta against the value of the
+    // previous sample published by the writer for the same key, computed with encodeDelta.
+    const std::int64_t deltaTag = -1;
+
+    // Encodes the value of a sample as a delta against the value of the base sample with the given ID. Returns an
+    // empty sequence if the delta isn't smaller than the value.
+    Ice::ByteSeq encodeDelta(const Ice::CommunicatorPtr&, std::int64_t, const Ice::ByteSeq&, const Ice::ByteSeq&);
+
+    // Resolves the delta encoded value of the sample against the value of the base sample, and sets the encoded
+    // value of the sample. Returns false if the base sample isn't the sample the delta was computed against.
+    bool decodeDelta(const Ice::CommunicatorPtr&, const std::shared_ptr<Sample>&, const std::shared_ptr<Sample>&);
+}
+
+#endif
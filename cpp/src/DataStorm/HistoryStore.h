@@ -0,0 +1,46 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef DATASTORM_HISTORY_STORE_H
+#define DATASTORM_HISTORY_STORE_H
+
+#include "DataStorm/Contract.h"
+
+#include <functional>
+
+namespace DataStormI
+{
+    // The persistent history of the node's writers. Each writer keeps its samples in the store, identified by the
+    // writer history name and the sample ID, and only a bounded tail of its history in memory.
+    //
+    // A record has a key if its keyId is 1: a single-key writer stores its samples without their key.
+    class HistoryStore
+    {
+    public:
+        virtual ~HistoryStore() = default;
+
+        // Returns whether the given writer history name can be stored.
+        [[nodiscard]] virtual bool isValidName(const std::string&) const = 0;
+
+        // Queues the addition of the given sample, if any, to the history of the writer and the removal of the
+        // samples with the given IDs. The queued updates are written asynchronously, in the order they're queued and
+        // together with the updates queued by the other writers.
+        virtual void
+        update(const std::string&, std::optional<DataStormContract::DataSample>, std::vector<std::int64_t>) = 0;
+
+        // Calls the function with the samples of the writer, from the oldest to the newest. The samples include the
+        // updates queued before the call.
+        virtual void load(const std::string&, const std::function<void(DataStormContract::DataSample&)>&) = 0;
+
+        // Calls the function with the samples of the writer whose ID is lower than the given ID, from the newest to
+        // the oldest, until the function returns false. The samples include the updates queued before the call.
+        virtual void
+        forEach(const std::string&, std::int64_t, const std::function<bool(DataStormContract::DataSample&)>&) = 0;
+    };
+
+#ifdef DATASTORM_LMDB
+    // Creates a history store backed by the LMDB database in the given directory.
+    std::shared_ptr<HistoryStore> createLMDBHistoryStore(const Ice::CommunicatorPtr&, const std::string&, int);
+#endif
+}
+
+#endif
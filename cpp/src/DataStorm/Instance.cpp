@@ -4,6 +4,7 @@
 #include "CallbackExecutor.h"
 #include "ConnectionManager.h"
 #include "DataStorm/Node.h"
+#include "HistoryStore.h"
 #include "LookupI.h"
 #include "NodeI.h"
 #include "NodeSessionManager.h"
@@ -91,6 +92,34 @@ Instance::Instance(CommunicatorPtr communicator, function<void(function<void()>
     _defaultWriterConfig.sampleCount = *_defaultReaderConfig.sampleCount;
     _defaultWriterConfig.sampleLifetime = *_defaultReaderConfig.sampleLifetime;
     _defaultWriterConfig.priority = properties->getIcePropertyAsInt("DataStorm.Topic.Priority");
+    _defaultWriterConfig.deltaKeyframeInterval =
+        properties->getIcePropertyAsInt("DataStorm.Topic.DeltaKeyframeInterval");
+
+    // A writer batches the samples it sends to a peer session only if BatchInterval is greater than 0. A BatchSize of 0
+    // doesn't limit the number of samples of a batch: the batch is only sent once BatchInterval elapses.
+    _batchInterval = chrono::milliseconds(max(properties->getIcePropertyAsInt("DataStorm.Topic.BatchInterval"), 0));
+    _batchSize = properties->getIcePropertyAsInt("DataStorm.Topic.BatchSize");
+    if (_batchSize < 0)
+    {
+        throw invalid_argument(
+            "property 'DataStorm.Topic.BatchSize' has an invalid value: the batch size can't be negative");
+    }
+
+    // When a database is configured, the writers keep their history in the database and only their most recent
+    // samples in memory.
+    string lmdbPath = properties->getIceProperty("DataStorm.Node.LMDB.Path");
+    if (!lmdbPath.empty())
+    {
+#ifdef DATASTORM_LMDB
+        _historyStore = createLMDBHistoryStore(
+            _communicator,
+            lmdbPath,
+            properties->getIcePropertyAsInt("DataStorm.Node.LMDB.MapSize"));
+#else
+        throw invalid_argument("DataStorm.Node.LMDB.Path is set but DataStorm was built without LMDB support");
+#endif
+    }
+    _historyCacheSize = max(properties->getIcePropertyAsInt("DataStorm.Topic.HistoryCacheSize"), 1);
 
     _retryDelay = chrono::milliseconds(properties->getIcePropertyAsInt("DataStorm.Node.RetryDelay"));
     _retryMultiplier = properties->getIcePropertyAsInt("DataStorm.Node.RetryMultiplier");
@@ -113,6 +142,23 @@ Instance::init(std::optional<Ice::SSL::ServerAuthenticationOptions> serverAuthen
         {
             properties->setProperty("DataStorm.Node.Server.Endpoints", "tcp");
         }
+        if (properties->getIcePropertyAsInt("DataStorm.Node.Server.SharedMemory") > 0)
+        {
+            // Listen first on a shared memory endpoint. Nodes on the same host connect to it and exchange samples
+            // through shared memory, nodes on other hosts fall back to the other endpoints. The application must load
+            // the IceSHM plug-in, it isn't loaded by default.
+            try
+            {
+                _communicator->getPluginManager()->getPlugin("IceSHM");
+            }
+            catch (const Ice::NotRegisteredException&)
+            {
+                throw invalid_argument("DataStorm.Node.Server.SharedMemory requires the IceSHM plug-in");
+            }
+            properties->setProperty(
+                "DataStorm.Node.Server.Endpoints",
+                "shm:" + properties->getIceProperty("DataStorm.Node.Server.Endpoints"));
+        }
         // Use a serialized thread pool to ensure that samples are processed in the order they are received. This is
         // especially important for PartialUpdate samples which depend on the order to compute the value.
         properties->setProperty("DataStorm.Node.Server.ThreadPool.Serialize", "1");
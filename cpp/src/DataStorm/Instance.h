@@ -21,6 +21,7 @@ namespace DataStormI
     class ForwarderManager;
     class NodeI;
     class CallbackExecutor;
+    class HistoryStore;
 
     // The object identity shared by all Lookup servants and proxies.
     inline Ice::Identity lookupIdentity() { return {.name = "Lookup2", .category = "DataStorm"}; }
@@ -105,6 +106,13 @@ namespace DataStormI
 
         [[nodiscard]] int getRetryCount() const { return _retryCount; }
 
+        [[nodiscard]] std::chrono::milliseconds getBatchInterval() const { return _batchInterval; }
+        [[nodiscard]] int getBatchSize() const { return _batchSize; }
+
+        // Returns the store of the writers history, or null if the writers keep their history only in memory.
+        [[nodiscard]] std::shared_ptr<HistoryStore> getHistoryStore() const { return _historyStore; }
+        [[nodiscard]] int getHistoryCacheSize() const { return _historyCacheSize; }
+
         void shutdown();
         [[nodiscard]] bool isShutdown() const;
         void checkShutdown() const;
@@ -160,6 +168,10 @@ namespace DataStormI
         std::chrono::milliseconds _retryDelay;
         int _retryMultiplier;
         int _retryCount;
+        std::chrono::milliseconds _batchInterval;
+        int _batchSize;
+        std::shared_ptr<HistoryStore> _historyStore;
+        int _historyCacheSize;
         DataStorm::ReaderConfig _defaultReaderConfig;
         DataStorm::WriterConfig _defaultWriterConfig;
 
@@ -0,0 +1,289 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "../IceDB/IceDB.h"
+#include "HistoryStore.h"
+#include "Ice/LoggerUtil.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+using namespace DataStormI;
+using namespace DataStormContract;
+
+namespace DataStormI
+{
+    // The key of a history record: the writer that published the sample, and the sample ID.
+    struct HistoryKey
+    {
+        std::string writer;
+        std::int64_t id;
+    };
+}
+
+namespace IceDB
+{
+    // History keys are written as the writer followed by a null byte and the sample ID in big-endian order. LMDB's
+    // default byte-wise comparison then keeps the records of a writer together and ordered by sample ID.
+    template<> struct Codec<HistoryKey, IceContext, Ice::OutputStream>
+    {
+        static void read(HistoryKey&, const MDB_val&, const IceContext&);
+        static void write(const HistoryKey&, MDB_val&, Ice::OutputStream&);
+        static bool write(const HistoryKey&, MDB_val&);
+    };
+}
+
+namespace
+{
+    const size_t idSize = sizeof(uint64_t);
+
+    void writeKey(const HistoryKey& key, byte* data)
+    {
+        memcpy(data, key.writer.data(), key.writer.size());
+        data[key.writer.size()] = byte{0};
+        auto id = static_cast<uint64_t>(key.id);
+        byte* p = data + key.writer.size() + 1;
+        for (size_t i = 0; i < idSize; ++i)
+        {
+            p[i] = static_cast<byte>(id >> (8 * (idSize - 1 - i)));
+        }
+    }
+
+    using SampleDbi = IceDB::Dbi<HistoryKey, DataSample, IceDB::IceContext, Ice::OutputStream>;
+    using SampleCursor = IceDB::ReadOnlyCursor<HistoryKey, DataSample, IceDB::IceContext, Ice::OutputStream>;
+
+    // The LMDB history store. The updates queued by the writers are written by a dedicated thread, which writes all
+    // the updates queued since its previous transaction in a single transaction: publishing a sample doesn't wait for
+    // a write transaction, and the writers don't serialize on the LMDB write lock.
+    class LMDBHistoryStore final : public HistoryStore
+    {
+    public:
+        LMDBHistoryStore(const Ice::CommunicatorPtr&, const string&, size_t);
+        ~LMDBHistoryStore() final;
+
+        [[nodiscard]] bool isValidName(const string&) const final;
+        void update(const string&, optional<DataSample>, vector<int64_t>) final;
+        void load(const string&, const function<void(DataSample&)>&) final;
+        void forEach(const string&, int64_t, const function<bool(DataSample&)>&) final;
+
+    private:
+        struct Update
+        {
+            string writer;
+            optional<DataSample> sample;
+            vector<int64_t> erase;
+        };
+
+        void run();
+        void sync();
+
+        const Ice::LoggerPtr _logger;
+        IceInternal::FileLock _dbLock;
+        IceDB::Env _dbEnv;
+        SampleDbi _samples;
+
+        mutex _mutex;
+        condition_variable _cond;
+        vector<Update> _queue;
+        uint64_t _queued{0};
+        uint64_t _written{0};
+        bool _destroyed{false};
+        thread _thread;
+    };
+}
+
+void
+IceDB::Codec<HistoryKey, IceDB::IceContext, Ice::OutputStream>::read(
+    HistoryKey& key,
+    const MDB_val& val,
+    const IceContext&)
+{
+    assert(val.mv_size > idSize);
+    const auto* data = static_cast<const unsigned char*>(val.mv_data);
+    const size_t writerSize = val.mv_size - idSize - 1;
+    key.writer.assign(reinterpret_cast<const char*>(data), writerSize);
+    uint64_t id = 0;
+    for (size_t i = 0; i < idSize; ++i)
+    {
+        id = (id << 8) | data[writerSize + 1 + i];
+    }
+    key.id = static_cast<int64_t>(id);
+}
+
+void
+IceDB::Codec<HistoryKey, IceDB::IceContext, Ice::OutputStream>::write(
+    const HistoryKey& key,
+    MDB_val& val,
+    Ice::OutputStream& holder)
+{
+    vector<byte> data(key.writer.size() + 1 + idSize);
+    writeKey(key, data.data());
+    holder.writeBlob(data);
+    val.mv_size = holder.b.size();
+    val.mv_data = &holder.b[0];
+}
+
+bool
+IceDB::Codec<HistoryKey, IceDB::IceContext, Ice::OutputStream>::write(const HistoryKey& key, MDB_val& val)
+{
+    const size_t size = key.writer.size() + 1 + idSize;
+    if (size > val.mv_size)
+    {
+        val.mv_size = size;
+        return false;
+    }
+    writeKey(key, static_cast<byte*>(val.mv_data));
+    val.mv_size = size;
+    return true;
+}
+
+LMDBHistoryStore::LMDBHistoryStore(const Ice::CommunicatorPtr& communicator, const string& path, size_t mapSize)
+    : _logger(communicator->getLogger()),
+      _dbLock(path + "/icedb.lock"),
+      _dbEnv(path, 1, mapSize)
+{
+    // The history is a cache of the samples published by the writers for late joining readers: favor publishing
+    // throughput over durability and let the OS flush the database. A system crash may lose the latest samples, but
+    // doesn't corrupt the database.
+    const int rc = mdb_env_set_flags(_dbEnv.menv(), MDB_NOSYNC, 1);
+    if (rc != MDB_SUCCESS)
+    {
+        throw IceDB::LMDBException(__FILE__, __LINE__, rc);
+    }
+
+    IceDB::ReadWriteTxn txn(_dbEnv);
+    _samples = SampleDbi(txn, "samples", IceDB::IceContext{communicator}, MDB_CREATE);
+    txn.commit();
+
+    _thread = thread([this] { run(); });
+}
+
+LMDBHistoryStore::~LMDBHistoryStore()
+{
+    {
+        lock_guard lock(_mutex);
+        _destroyed = true;
+    }
+    _cond.notify_all();
+
+    // The thread writes the queued updates before it exits.
+    _thread.join();
+}
+
+bool
+LMDBHistoryStore::isValidName(const string& writer) const
+{
+    return writer.size() + 1 + idSize <= IceDB::maxKeySize;
+}
+
+void
+LMDBHistoryStore::update(const string& writer, optional<DataSample> sample, vector<int64_t> erase)
+{
+    {
+        lock_guard lock(_mutex);
+        _queue.push_back(Update{writer, std::move(sample), std::move(erase)});
+        ++_queued;
+    }
+    _cond.notify_all();
+}
+
+void
+LMDBHistoryStore::load(const string& writer, const function<void(DataSample&)>& callback)
+{
+    sync();
+
+    IceDB::ReadOnlyTxn txn(_dbEnv);
+    SampleCursor cursor(_samples, txn);
+
+    HistoryKey key{writer, 0};
+    DataSample sample;
+    bool found = cursor.findRange(key, sample);
+    while (found && key.writer == writer)
+    {
+        callback(sample);
+        found = cursor.get(key, sample, MDB_NEXT);
+    }
+}
+
+void
+LMDBHistoryStore::forEach(const string& writer, int64_t beforeId, const function<bool(DataSample&)>& callback)
+{
+    sync();
+
+    IceDB::ReadOnlyTxn txn(_dbEnv);
+    SampleCursor cursor(_samples, txn);
+
+    // Position the cursor on the first record following the samples to visit, and move backward from there. If
+    // there's no such record, the samples to visit are the last records of the database.
+    HistoryKey key{writer, beforeId};
+    DataSample sample;
+    bool found = cursor.findRange(key, sample) ? cursor.get(key, sample, MDB_PREV) : cursor.get(key, sample, MDB_LAST);
+    while (found && key.writer == writer && callback(sample))
+    {
+        found = cursor.get(key, sample, MDB_PREV);
+    }
+}
+
+void
+LMDBHistoryStore::run()
+{
+    unique_lock lock(_mutex);
+    while (true)
+    {
+        _cond.wait(lock, [this] { return _destroyed || !_queue.empty(); });
+        if (_queue.empty())
+        {
+            return; // Destroyed, and all the updates are written.
+        }
+
+        vector<Update> updates;
+        updates.swap(_queue);
+        const uint64_t queued = _queued;
+        lock.unlock();
+
+        try
+        {
+            IceDB::ReadWriteTxn txn(_dbEnv);
+            for (const auto& update : updates)
+            {
+                for (auto id : update.erase)
+                {
+                    _samples.del(txn, HistoryKey{update.writer, id});
+                }
+                if (update.sample)
+                {
+                    _samples.put(txn, HistoryKey{update.writer, update.sample->id}, *update.sample);
+                }
+            }
+            txn.commit();
+        }
+        catch (const std::exception& ex)
+        {
+            // The samples are still published, and kept in memory by their writers. They're missing from the stored
+            // history, which can't restore them after a restart, nor provide them to readers once they're evicted
+            // from memory.
+            Ice::Warning out(_logger);
+            out << "failed to write " << updates.size() << " updates to the DataStorm history store:\n" << ex.what();
+        }
+
+        lock.lock();
+        _written = queued;
+        _cond.notify_all();
+    }
+}
+
+void
+LMDBHistoryStore::sync()
+{
+    unique_lock lock(_mutex);
+    const uint64_t queued = _queued;
+    _cond.wait(lock, [this, queued] { return _written >= queued; });
+}
+
+shared_ptr<HistoryStore>
+DataStormI::createLMDBHistoryStore(const Ice::CommunicatorPtr& communicator, const string& path, int mapSize)
+{
+    return make_shared<LMDBHistoryStore>(communicator, path, IceDB::getMapSize(mapSize));
+}
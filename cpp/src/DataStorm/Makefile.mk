@@ -9,4 +9,12 @@ DataStorm_targetdir     := $(libdir)
 DataStorm_cppflags      := -DDATASTORM_API_EXPORTS $(api_exports_cppflags)
 DataStorm_dependencies  := Ice
 
+ifeq ($(DATASTORM_LMDB),yes)
+DataStorm_cppflags      += -DDATASTORM_LMDB $(if $(lmdb_includedir),-I$(lmdb_includedir))
+DataStorm_libs          := lmdb
+DataStorm_extra_sources := src/IceDB/IceDB.cpp
+else
+DataStorm_excludes      := $(currentdir)/LMDBHistoryStore.cpp
+endif
+
 projects += $(project)
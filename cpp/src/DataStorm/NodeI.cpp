@@ -9,6 +9,8 @@
 #include "TopicFactoryI.h"
 #include "TraceUtil.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace DataStormI;
 using namespace DataStormContract;
@@ -16,6 +18,10 @@ using namespace Ice;
 
 namespace
 {
+    // The context entry a subscriber node sets on its createSession request to tell the publisher node that it accepts
+    // delta encoded updates. A subscriber node that predates delta encoding doesn't set it, and only gets full values.
+    const string deltaEncodingContext = "DataStorm.DeltaEncoding";
+
     class SessionDispatcher : public Object
     {
     public:
@@ -220,6 +226,7 @@ NodeI::createSessionAsync(
         // else collocated call.
 
         auto traceLevels = instance->getTraceLevels();
+        const bool deltaEncoding = current.ctx.find(deltaEncodingContext) != current.ctx.end();
 
         unique_lock<mutex> lock(_mutex);
         session = createPublisherSessionServant(*subscriber);
@@ -267,14 +274,15 @@ NodeI::createSessionAsync(
                     s->confirmCreateSessionAsync(
                         self->_proxy,
                         uncheckedCast<PublisherSessionPrx>(session->getProxy()),
-                        [session, subscriberSession, connection, instance]
+                        [session, subscriberSession, connection, instance, deltaEncoding]
                         {
                             // Session::connected informs the subscriber session of all the topic writers in the
                             // current node.
                             session->connected(
                                 *subscriberSession,
                                 connection,
-                                instance->getTopicFactory()->getTopicWriters());
+                                instance->getTopicFactory()->getTopicWriters(),
+                                deltaEncoding);
                         },
                         [self, subscriber, session, connectAttempt](auto ex)
                         { self->retryPublisherSessionCreation(*subscriber, session, ex, connectAttempt); });
@@ -375,7 +383,7 @@ NodeI::confirmCreateSessionAsync(
     // Session::connected informs the publisher session of all the topic readers in the current node. The publisher
     // session is not connected yet - it connects when the confirmation response arrives - so it drops this initial
     // announcement; the attachment is instead driven by the publisher's own topic announcement, sent once connected.
-    session->connected(*publisherSession, current.con, instance->getTopicFactory()->getTopicReaders());
+    session->connected(*publisherSession, current.con, instance->getTopicFactory()->getTopicReaders(), false);
 
     // Send the response only after this session is connected: the response is the publisher's send barrier. The
     // publisher marks its session connected and starts announcing topics and forwarding samples only after this node
@@ -476,7 +484,9 @@ NodeI::createPublisherSession(
             false,
             nullptr,
             [self = shared_from_this(), publisher, session, connectAttempt](exception_ptr ex)
-            { self->retrySubscriberSessionCreation(publisher, session, ex, connectAttempt); });
+            { self->retrySubscriberSessionCreation(publisher, session, ex, connectAttempt); },
+            nullptr,
+            Context{{deltaEncodingContext, "1"}});
     }
     catch (const CommunicatorDestroyedException&)
     {
@@ -737,5 +747,16 @@ NodeI::getNodeWithExistingConnection(
     }
 
     // Ensure that the returned proxy doesn't have a cached connection.
-    return node->ice_connectionCached(false)->ice_connectionCached(true);
+    auto proxy = node->ice_connectionCached(false)->ice_connectionCached(true);
+
+    // A node with DataStorm.Node.Server.SharedMemory set publishes its shared memory endpoint first, try it first.
+    auto endpoints = proxy->ice_getEndpoints();
+    if (any_of(
+            endpoints.begin(),
+            endpoints.end(),
+            [](const EndpointPtr& endpoint) { return endpoint->getInfo()->type() == SHMEndpointType; }))
+    {
+        proxy = proxy->ice_endpointSelection(EndpointSelectionType::Ordered);
+    }
+    return proxy;
 }
@@ -93,7 +93,15 @@ namespace
                         subscriberIsHostedOnRelay ? subscriberSession->ice_fixed(current.con) : *subscriberSession);
 
                     // Forward the call to the target Node.
-                    _node->createSessionAsync(subscriber, subscriberSessionForwarder, true, response, exception);
+                    // Forward the context too, it tells whether the subscriber accepts delta encoded updates.
+                    _node->createSessionAsync(
+                        subscriber,
+                        subscriberSessionForwarder,
+                        true,
+                        response,
+                        exception,
+                        nullptr,
+                        current.ctx);
                 }
                 catch (const CommunicatorDestroyedException&)
                 {
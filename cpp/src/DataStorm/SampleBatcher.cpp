@@ -0,0 +1,103 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "SampleBatcher.h"
+#include "Instance.h"
+
+using namespace std;
+using namespace DataStormI;
+using namespace DataStormContract;
+
+SampleBatcher::SampleBatcher(const shared_ptr<Instance>& instance)
+    : _instance(instance),
+      _interval(instance->getBatchInterval()),
+      _size(instance->getBatchSize())
+{
+}
+
+void
+SampleBatcher::setConnection(Ice::ConnectionPtr connection)
+{
+    lock_guard<mutex> lock(_mutex);
+    _connection = std::move(connection);
+    _count = 0;
+}
+
+bool
+SampleBatcher::queue(
+    const SessionPrx& proxy,
+    string_view operation,
+    Ice::OperationMode mode,
+    const Ice::ByteSeq& inParams,
+    const Ice::Context& ctx)
+{
+    assert(proxy->ice_isBatchOneway());
+
+    lock_guard<mutex> lock(_mutex);
+
+    // The batch requests of a fixed proxy are queued on its connection, and flushed with the connection. A collocated
+    // peer session has no connection to batch the samples on.
+    if (!_connection || proxy->ice_getCachedConnection() != _connection)
+    {
+        return false;
+    }
+
+    try
+    {
+        // Invoking on a batch oneway proxy only queues the request.
+        Ice::ByteSeq outParams;
+        proxy->ice_invoke(operation, mode, inParams, outParams, ctx);
+    }
+    catch (const Ice::LocalException&)
+    {
+        // The connection is closed, the session handles the connection loss.
+        return true;
+    }
+
+    if (++_count >= _size && _size > 0)
+    {
+        flushImpl();
+    }
+    else if (!_flushScheduled)
+    {
+        if (auto instance = _instance.lock())
+        {
+            _flushScheduled = true;
+            instance->scheduleTimerTask([self = shared_from_this()] { self->flush(); }, _interval);
+        }
+        else
+        {
+            // The node is being destroyed, send the sample right away.
+            flushImpl();
+        }
+    }
+    return true;
+}
+
+void
+SampleBatcher::flush()
+{
+    lock_guard<mutex> lock(_mutex);
+    flushImpl();
+}
+
+void
+SampleBatcher::flushImpl()
+{
+    // Called with the mutex locked.
+    _flushScheduled = false;
+    if (_count == 0)
+    {
+        return;
+    }
+    _count = 0;
+
+    // Send the queued samples, we don't need to wait for the result. A failure is handled by the session, which
+    // detects the connection loss as it does for the samples sent without batching.
+    try
+    {
+        _connection->flushBatchRequestsAsync(Ice::CompressBatch::BasedOnProxy, nullptr);
+    }
+    catch (const Ice::LocalException&)
+    {
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef DATASTORM_SAMPLE_BATCHER_H
+#define DATASTORM_SAMPLE_BATCHER_H
+
+#include "DataStorm/Contract.h"
+#include "Ice/Ice.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace DataStormI
+{
+    class Instance;
+
+    /// Coalesces the samples the writers forward to a peer session into batch requests. The samples are queued on
+    /// the connection of the peer session and sent together at most BatchInterval milliseconds after the first queued
+    /// sample, or as soon as BatchSize samples are queued. The batch requests are sent in a single message and
+    /// dispatched in order by the peer session.
+    ///
+    /// Each session has its own batcher, shared by all the writers forwarding samples to the peer session. The other
+    /// calls sent to the peer session must flush the batcher first, so that the peer receives them in order with the
+    /// batched samples.
+    class SampleBatcher final : public std::enable_shared_from_this<SampleBatcher>
+    {
+    public:
+        SampleBatcher(const std::shared_ptr<Instance>&);
+
+        /// Sets the connection of the peer session, or null once the session is disconnected.
+        void setConnection(Ice::ConnectionPtr);
+
+        /// Queues a sample sent with the given batch oneway proxy for the peer session.
+        /// @return `false` if the proxy isn't bound to the connection of the peer session: the caller must send the
+        /// sample itself.
+        [[nodiscard]] bool queue(
+            const DataStormContract::SessionPrx&,
+            std::string_view,
+            Ice::OperationMode,
+            const Ice::ByteSeq&,
+            const Ice::Context&);
+
+        /// Sends the queued samples, if any.
+        void flush();
+
+    private:
+        void flushImpl();
+
+        const std::weak_ptr<Instance> _instance;
+        const std::chrono::milliseconds _interval;
+        const int _size;
+
+        // Held while the samples are queued and flushed: a call which flushes the batcher before sending another
+        // request to the peer session is sent after the samples queued before, even if another thread flushes them.
+        std::mutex _mutex;
+        Ice::ConnectionPtr _connection;
+        int _count{0};
+        bool _flushScheduled{false};
+    };
+}
+
+#endif
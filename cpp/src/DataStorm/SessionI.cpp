@@ -5,6 +5,7 @@
 #include "ConnectionManager.h"
 #include "Instance.h"
 #include "NodeI.h"
+#include "SampleBatcher.h"
 #include "TopicFactoryI.h"
 #include "TopicI.h"
 #include "TraceUtil.h"
@@ -90,6 +91,9 @@ SessionI::SessionI(shared_ptr<Instance> instance, shared_ptr<NodeI> parent, Node
       _traceLevels{_instance->getTraceLevels()},
       _parent{std::move(parent)},
       _proxy{std::move(proxy)},
+      _batcher{
+          _instance->getBatchInterval() > chrono::milliseconds::zero() ? make_shared<SampleBatcher>(_instance)
+                                                                        : nullptr},
       _id{identityToString(_proxy->ice_getIdentity())},
       _node{std::move(node)}
 {
@@ -145,6 +149,7 @@ SessionI::announceTopics(TopicInfoSeq topics, bool, const Current&)
                     {
                         topic->attach(id, shared_from_this(), *_session);
                     }
+                    flushSamples();
                     _session->attachTopicAsync(topic->getTopicSpec(), nullptr);
                 });
         }
@@ -225,6 +230,7 @@ SessionI::attachTopic(TopicSpec spec, const Current&)
                 auto tags = topic->getTags();
                 if (!tags.empty())
                 {
+                    flushSamples();
                     _session->attachTagsAsync(topic->getId(), tags, true, nullptr);
                 }
 
@@ -237,6 +243,7 @@ SessionI::attachTopic(TopicSpec spec, const Current&)
                         Trace out(_traceLevels->logger, _traceLevels->sessionCat);
                         out << _id << ": matched elements '" << spec << "' on '" << topic << "'";
                     }
+                    flushSamples();
                     // Don't wait for the response here, the peer session will send an ack. The request is addressed
                     // to the remote topic instance we are attaching to (spec.id).
                     _session->attachElementsAsync(topic->getId(), spec.id, specs, true, nullptr);
@@ -377,6 +384,7 @@ SessionI::announceElements(int64_t topicId, ElementInfoSeq elements, const Curre
                     out << _id << ": announcing elements matched '[" << specs << "]@" << topicId << "' on topic '"
                         << topic << "'";
                 }
+                flushSamples();
                 // Addressed to the remote topic instance that announced these elements (topicId).
                 _session->attachElementsAsync(topic->getId(), topicId, specs, false, nullptr);
             }
@@ -393,6 +401,7 @@ SessionI::attachElements(int64_t topicId, int64_t peerTopicId, ElementSpecSeq el
     }
 
     auto now = chrono::system_clock::now();
+    auto prefetchedHistory = prefetchHistory(topicId, peerTopicId);
     // Attach the elements to the addressed local topic and ack them to the peer. Routing to exactly the addressed
     // topic (rather than every same-name topic) keeps the echoed element and key ids unambiguous.
     runWithTopics(
@@ -429,6 +438,7 @@ SessionI::attachElements(int64_t topicId, int64_t peerTopicId, ElementSpecSeq el
                     out << _id << ": attaching elements matched '[" << specAck << "]@" << topicId << "' on topic '"
                         << topic << "'";
                 }
+                flushSamples();
                 // Addressed back to the remote topic instance that sent attachElements (topicId).
                 _session->attachElementsAckAsync(topic->getId(), topicId, specAck, nullptr);
             }
@@ -444,6 +454,7 @@ SessionI::attachElementsAck(int64_t topicId, int64_t peerTopicId, ElementSpecAck
         return;
     }
     auto now = chrono::system_clock::now();
+    auto prefetchedHistory = prefetchHistory(topicId, peerTopicId);
     runWithTopics(
         topicId,
         peerTopicId,
@@ -469,12 +480,14 @@ SessionI::attachElementsAck(int64_t topicId, int64_t peerTopicId, ElementSpecAck
                     out << _id << ": initializing elements '[" << initializationBatches << "]@" << topicId
                         << "' on topic '" << topic << "'";
                 }
+                flushSamples();
                 // Addressed back to the remote topic instance that sent the ack (topicId).
                 _session->initSamplesAsync(topic->getId(), topicId, initializationBatches, nullptr);
             }
 
             if (!removedIds.empty())
             {
+                flushSamples();
                 _session->detachElementsAsync(topic->getId(), removedIds, nullptr);
             }
         });
@@ -661,7 +674,11 @@ SessionI::disconnected(const Current& current)
 }
 
 void
-SessionI::connected(SessionPrx session, const ConnectionPtr& newConnection, const TopicInfoSeq& topics)
+SessionI::connected(
+    SessionPrx session,
+    const ConnectionPtr& newConnection,
+    const TopicInfoSeq& topics,
+    bool deltaEncoding)
 {
     lock_guard<mutex> lock(_mutex);
     if (_destroyed || _session)
@@ -672,6 +689,11 @@ SessionI::connected(SessionPrx session, const ConnectionPtr& newConnection, cons
 
     _session = std::move(session);
     _connection = newConnection;
+    if (_batcher)
+    {
+        _batcher->setConnection(newConnection);
+    }
+    _deltaEncoding = deltaEncoding;
     if (newConnection)
     {
         auto self = shared_from_this();
@@ -808,6 +830,10 @@ SessionI::disconnectedImpl(const ConnectionPtr& connection, exception_ptr ex)
 
     _session = nullopt;
     _connection = nullptr;
+    if (_batcher)
+    {
+        _batcher->setConnection(nullptr);
+    }
     _retryCount = 0;
     return true;
 }
@@ -1030,6 +1056,10 @@ SessionI::destroyImpl(const exception_ptr& ex)
 
         _session = nullopt;
         _connection = nullptr;
+        if (_batcher)
+        {
+            _batcher->setConnection(nullptr);
+        }
 
         auto self = shared_from_this();
         for (auto& [topicId, subscribers] : _topics)
@@ -1090,6 +1120,15 @@ SessionI::getConnection() const
     return _connection;
 }
 
+void
+SessionI::flushSamples() const
+{
+    if (_batcher)
+    {
+        _batcher->flush();
+    }
+}
+
 bool
 SessionI::checkSession()
 {
@@ -1633,6 +1672,24 @@ SessionI::runWithTopics(
     }
 }
 
+shared_ptr<void>
+SessionI::prefetchHistory(int64_t topicId, int64_t peerTopicId)
+{
+    auto t = _topics.find(topicId);
+    if (t != _topics.end())
+    {
+        for (const auto& [weakTopic, subscriber] : t->second.getSubscribers())
+        {
+            auto topic = weakTopic.lock();
+            if (topic && topic->getId() == peerTopicId)
+            {
+                return topic->prefetchHistory();
+            }
+        }
+    }
+    return nullptr;
+}
+
 void
 SessionI::runWithTopic(
     int64_t topicId,
@@ -1792,32 +1849,37 @@ SubscriberSessionI::s(int64_t topicId, int64_t elementId, DataSample dataSample,
                 }
                 assert(key);
 
+                const bool deltaEncoded = dataSample.tag == deltaTag;
                 auto createSample = [&]
                 {
-                    return topic->getSampleFactory()->create(
+                    auto sample = topic->getSampleFactory()->create(
                         _id,
                         elementSubscribers->name,
                         dataSample.id,
                         dataSample.event,
                         key,
-                        topicSubscriber.findTag(dataSample.tag),
+                        deltaEncoded ? nullptr : topicSubscriber.findTag(dataSample.tag),
                         dataSample.value,
                         dataSample.timestamp);
+                    sample->deltaEncoded = deltaEncoded;
+                    return sample;
                 };
 
                 // A full value is decoded into the sample the same way whatever element receives it, so the elements
-                // subscribed to this writer element share a single sample, decoded once. A partial update is not: each
-                // element resolves it against its own current value for the key and the resolved value is written into
-                // the sample, so each element gets a sample of its own.
+                // subscribed to this writer element share a single sample, decoded once. A partial update or a delta
+                // encoded update is not: each element resolves it against its own current value for the key and the
+                // resolved value is written into the sample, so each element gets a sample of its own.
                 shared_ptr<Sample> sharedSample;
-                if (dataSample.event != DataStorm::SampleEvent::PartialUpdate)
+                if (dataSample.event != DataStorm::SampleEvent::PartialUpdate && !deltaEncoded)
                 {
                     sharedSample = createSample();
                 }
 
                 for (auto& [element, elementSubscriber] : elementSubscribers->getSubscribers())
                 {
-                    if (elementSubscriber.initialized &&
+                    // The writer adds a sample to its history before sending it: a sample already received with the
+                    // initialization samples is ignored.
+                    if (elementSubscriber.initialized && dataSample.id > elementSubscriber.lastId &&
                         (dataSample.keyId <= 0 || elementSubscriber.keys.find(key) != elementSubscriber.keys.end()))
                     {
                         auto elementSample = sharedSample ? sharedSample : createSample();
@@ -20,6 +20,7 @@ namespace DataStormI
     class TopicI;
     class DataElementI;
     class Instance;
+    class SampleBatcher;
     class TraceLevels;
 
     class SessionI : public virtual DataStormContract::Session, public std::enable_shared_from_this<SessionI>
@@ -309,8 +310,16 @@ namespace DataStormI
 
         void disconnected(const Ice::Current&) final;
 
-        void
-        connected(DataStormContract::SessionPrx, const Ice::ConnectionPtr&, const DataStormContract::TopicInfoSeq&);
+        /// Connects the session to the peer session.
+        /// @param session The peer session.
+        /// @param connection The connection to the peer node, or nullptr for a collocated peer.
+        /// @param topics The topics announced to the peer.
+        /// @param deltaEncoding Whether the peer accepts delta encoded updates. Always false for a subscriber session.
+        void connected(
+            DataStormContract::SessionPrx session,
+            const Ice::ConnectionPtr& connection,
+            const DataStormContract::TopicInfoSeq& topics,
+            bool deltaEncoding);
 
         /// Handles a disconnect notification (the peer's disconnected() request or the connection closure) and,
         /// when the session was connected, schedules the reconnection retry. Handling both under a single lock
@@ -335,6 +344,9 @@ namespace DataStormI
         [[nodiscard]] const std::string& getId() const { return _id; }
 
         [[nodiscard]] Ice::ConnectionPtr getConnection() const;
+
+        // Returns whether the peer accepts delta encoded updates. Called with the session mutex locked.
+        [[nodiscard]] bool deltaEncoding() const { return _deltaEncoding; }
         [[nodiscard]] std::optional<DataStormContract::SessionPrx> getSession() const;
         [[nodiscard]] bool checkSession();
 
@@ -359,6 +371,14 @@ namespace DataStormI
 
         [[nodiscard]] DataStormContract::SessionPrx getProxy() const { return _proxy; }
 
+        // Returns the batcher of the samples forwarded to the peer session, or null if the writers don't batch
+        // samples.
+        [[nodiscard]] const std::shared_ptr<SampleBatcher>& getSampleBatcher() const { return _batcher; }
+
+        // Sends the samples batched for the peer session. Must be called before sending another call to the peer
+        // session, for the peer to receive the calls in order.
+        void flushSamples() const;
+
         [[nodiscard]] DataStormContract::NodePrx getNode() const;
         void setNode(DataStormContract::NodePrx);
 
@@ -454,6 +474,14 @@ namespace DataStormI
             std::int64_t peerTopicId,
             const std::function<void(const std::shared_ptr<TopicI>&, TopicSubscriber&)>& callback);
 
+        /// Reads the stored history of the writers of the local topic addressed by runWithTopics(topicId, peerTopicId),
+        /// before the topic mutex is locked to attach elements. See TopicI::prefetchHistory.
+        ///
+        /// @param topicId The remote (sender's) topic id the local topics are subscribed to.
+        /// @param peerTopicId The local topic instance the request is addressed to.
+        /// @return An object which releases the history read when it's destroyed, or null.
+        [[nodiscard]] std::shared_ptr<void> prefetchHistory(std::int64_t topicId, std::int64_t peerTopicId);
+
         /// Runs the provided callback function for the specified topic, if it is among the subscribers for the given
         /// topic ID.
         /// The callback is executed with the topic's mutex locked.
@@ -501,6 +529,9 @@ namespace DataStormI
         // The proxy representing this session instance.
         DataStormContract::SessionPrx _proxy;
 
+        // The batcher of the samples forwarded to the peer session, or null if the writers don't batch samples.
+        const std::shared_ptr<SampleBatcher> _batcher;
+
         // The stringified identity of the session.
         std::string _id;
 
@@ -536,6 +567,9 @@ namespace DataStormI
 
         // The connection to the peer node, or `nullptr` if the session is disconnected.
         Ice::ConnectionPtr _connection;
+
+        // Whether the peer accepts delta encoded updates, as negotiated when the session connected.
+        bool _deltaEncoding{false};
     };
 
     class SubscriberSessionI : public SessionI, public DataStormContract::SubscriberSession
@@ -715,6 +715,48 @@ TopicI::attachElementsAck(
     return batches;
 }
 
+shared_ptr<void>
+TopicI::prefetchHistory()
+{
+    if (!_instance->getHistoryStore())
+    {
+        return nullptr;
+    }
+
+    set<shared_ptr<DataElementI>> elements;
+    {
+        lock_guard<mutex> lock(_mutex);
+        if (_destroyed)
+        {
+            return nullptr;
+        }
+        for (const auto& [key, keyElements] : _keyElements)
+        {
+            elements.insert(keyElements.begin(), keyElements.end());
+        }
+        for (const auto& [filter, filteredElements] : _filteredElements)
+        {
+            elements.insert(filteredElements.begin(), filteredElements.end());
+        }
+    }
+
+    for (const auto& element : elements)
+    {
+        element->prefetchHistory();
+    }
+
+    return shared_ptr<void>(
+        nullptr,
+        [self = shared_from_this(), elements = std::move(elements)](void*)
+        {
+            lock_guard<mutex> lock(self->_mutex);
+            for (const auto& element : elements)
+            {
+                element->releaseHistory();
+            }
+        });
+}
+
 void
 TopicI::setUpdater(const shared_ptr<Tag>& tag, Updater updater)
 {
@@ -905,8 +947,11 @@ void
 TopicI::forward(const ByteSeq& inParams, const Current& current) const
 {
     // Forwarder proxy must be called with the mutex locked!
-    for (const auto& [_, listener] : _listeners)
+    for (const auto& [session, listener] : _listeners)
     {
+        // Send the samples batched for the peer session first, the peer must receive the calls in order.
+        session->flushSamples();
+
         // Forward the call to all listeners using their session proxies, passing nullptr for the callbacks because we
         // don't need to check the result.
         listener.proxy
@@ -1203,5 +1248,11 @@ TopicWriterI::mergeConfigs(DataStorm::WriterConfig config) const
         assert(_defaultConfig.priority.has_value());
         config.priority = _defaultConfig.priority;
     }
+
+    if (!config.deltaKeyframeInterval.has_value())
+    {
+        assert(_defaultConfig.deltaKeyframeInterval.has_value());
+        config.deltaKeyframeInterval = _defaultConfig.deltaKeyframeInterval;
+    }
     return config;
 }
@@ -8,6 +8,8 @@
 #include "DataStorm/Types.h"
 #include "Instance.h"
 
+#include <atomic>
+
 namespace DataStormI
 {
     class SessionI;
@@ -87,6 +89,13 @@ namespace DataStormI
             const std::chrono::time_point<std::chrono::system_clock>&,
             Ice::LongSeq&);
 
+        /// Reads the stored history of the topic writers, before the session locks the topic mutex to attach
+        /// elements. Called without the topic mutex locked.
+        ///
+        /// @return An object which releases the history read when it's destroyed, with the topic mutex not locked, or
+        /// null if the writers have no stored history.
+        [[nodiscard]] std::shared_ptr<void> prefetchHistory();
+
         void setUpdater(const std::shared_ptr<Tag>&, Updater) override;
         [[nodiscard]] const Updater& getUpdater(const std::shared_ptr<Tag>&) const;
 
@@ -190,7 +199,8 @@ namespace DataStormI
         // Any-key and filtered elements are both presented to the peer as negated ids (filter subscriptions), so
         // distinct raw values are required across all of them to keep their subscriptions apart.
         std::int64_t _nextId{0};
-        std::int64_t _nextSampleId{0};
+        // Incremented by the writers of the topic without holding the topic mutex.
+        std::atomic<std::int64_t> _nextSampleId{0};
     };
 
     class TopicReaderI final : public TopicReader, public TopicI
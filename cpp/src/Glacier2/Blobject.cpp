@@ -3,6 +3,7 @@
 #include "Blobject.h"
 #include "ForwardObserver.h"
 #include "Instrumentation.h"
+#include "RequestBatcher.h"
 #include "SessionRouterI.h"
 
 using namespace std;
@@ -21,7 +22,8 @@ Glacier2::Blobject::Blobject(
       _forwardContext(_reverseConnection ? _instance->serverForwardContext() : _instance->clientForwardContext()),
       _requestTraceLevel(
           _reverseConnection ? _instance->serverRequestTraceLevel() : _instance->clientRequestTraceLevel()),
-      _context(std::move(context))
+      _context(std::move(context)),
+      _batcher(_reverseConnection ? _instance->serverBatcher() : _instance->clientBatcher())
 {
 }
 
@@ -88,14 +90,14 @@ Glacier2::Blobject::invoke(
 
                 case 'O':
                 {
-                    // Batch support has been removed. These requests will be forwarded as oneway
+                    // Forwarded as oneway, and batched when Glacier2.Client/Server.BatchInterval is set.
                     proxy = proxy->ice_oneway();
                     break;
                 }
 
                 case 'D':
                 {
-                    // Batch support has been removed. These requests will be forwarded as datagram
+                    // Forwarded as datagram, and batched when Glacier2.Client/Server.BatchInterval is set.
                     proxy = proxy->ice_datagram();
                     break;
                 }
@@ -153,6 +155,29 @@ Glacier2::Blobject::invoke(
 
     try
     {
+        if (_batcher && (proxy->ice_isOneway() || proxy->ice_isDatagram()))
+        {
+            Context ctx = _forwardContext ? current.ctx : Context{};
+            ctx.insert(_context.begin(), _context.end());
+            _batcher->invoke(
+                proxy,
+                _reverseConnection,
+                current.operation,
+                current.mode,
+                inParams,
+                ctx,
+                std::move(response),
+                exception);
+            return;
+        }
+
+        if (_batcher)
+        {
+            // Send the oneway requests queued for the target connection first: the twoway request must not overtake
+            // them.
+            _batcher->flush(proxy, _reverseConnection);
+        }
+
         function<void(bool, pair<const byte*, const byte*>)> amiResponse = nullptr;
         function<void(bool)> amiSent = nullptr;
 
@@ -9,6 +9,7 @@
 namespace Glacier2
 {
     class ForwardObserver;
+    class RequestBatcher;
 
     class Blobject : public Ice::BlobjectArrayAsync, public std::enable_shared_from_this<Blobject>
     {
@@ -31,6 +32,7 @@ namespace Glacier2
         const bool _forwardContext;
         const int _requestTraceLevel;
         const Ice::Context _context;
+        const std::shared_ptr<RequestBatcher> _batcher;
     };
 }
 
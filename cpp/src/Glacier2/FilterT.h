@@ -3,16 +3,30 @@
 #define FILTER_I_H
 
 #include "Glacier2/Session.h"
+#include "IdentityHash.h"
 #include "Ice/Identity.h"
 
 #include <algorithm>
-#include <list>
-#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace Glacier2
 {
+    template<typename T> struct FilterHash : std::hash<T>
+    {
+    };
+
+    template<> struct FilterHash<Ice::Identity> : IdentityHash
+    {
+    };
+
+    //
+    // The filter items are kept in a hash set: match() is called for each request forwarded by the client blobject
+    // and its cost doesn't depend on the number of items. It only takes a shared lock, so concurrent requests from
+    // the same session don't serialize on the filter.
+    //
     template<typename T, class P> class FilterT : public P
     {
     public:
@@ -30,107 +44,45 @@ namespace Glacier2
         //
         bool match(const T& candidate) const
         {
-            std::lock_guard<std::mutex> lg(_mutex);
+            std::shared_lock lock(_mutex);
             //
-            // Empty vectors mean no filtering, so all matches will succeed.
+            // Empty sets mean no filtering, so all matches will succeed.
             //
-            if (_items.size() == 0)
+            if (_items.empty())
             {
                 return true;
             }
 
-            return binary_search(_items.begin(), _items.end(), candidate);
+            return _items.find(candidate) != _items.end();
         }
 
         [[nodiscard]] bool empty() const
         {
-            std::lock_guard<std::mutex> lg(_mutex);
-            return _items.size() == 0;
+            std::shared_lock lock(_mutex);
+            return _items.empty();
         }
 
     private:
-        std::vector<T> _items;
+        std::unordered_set<T, FilterHash<T>> _items;
 
-        mutable std::mutex _mutex;
+        mutable std::shared_mutex _mutex;
     };
 
-    template<class T, class P> FilterT<T, P>::FilterT(const std::vector<T>& accept) : _items(accept)
+    template<class T, class P>
+    FilterT<T, P>::FilterT(const std::vector<T>& accept) : _items(accept.begin(), accept.end())
     {
-        sort(_items.begin(), _items.end());
-        _items.erase(unique(_items.begin(), _items.end()), _items.end());
     }
 
     template<class T, class P> void FilterT<T, P>::add(std::vector<T> additions, const Ice::Current&)
     {
-        //
-        // Sort the filter elements first, erasing duplicates. Then we can
-        // simply use the STL merge algorithm to add to our list of filters.
-        //
-        std::vector<T> newItems(additions);
-        sort(newItems.begin(), newItems.end());
-        newItems.erase(unique(newItems.begin(), newItems.end()), newItems.end());
-
-        std::lock_guard<std::mutex> lg(_mutex);
-        std::vector<T> merged(_items.size() + newItems.size());
-        merge(newItems.begin(), newItems.end(), _items.begin(), _items.end(), merged.begin());
-        merged.erase(unique(merged.begin(), merged.end()), merged.end());
-        swap(_items, merged);
+        std::lock_guard lock(_mutex);
+        _items.insert(additions.begin(), additions.end());
     }
 
     template<class T, class P> void FilterT<T, P>::remove(std::vector<T> deletions, const Ice::Current&)
     {
-        //
-        // Our removal algorithm depends on the filter elements to be
-        // removed to be sorted in the same order as our current elements.
-        //
-        std::vector<T> toRemove(deletions);
-        sort(toRemove.begin(), toRemove.end());
-        toRemove.erase(unique(toRemove.begin(), toRemove.end()), toRemove.end());
-
-        std::lock_guard<std::mutex> lg(_mutex);
-
-        //
-        // Our vectors are both sorted, so if we keep track of our first
-        // match between the current set and the set of items to be removed,
-        // we do not need to traverse the whole of the current set each
-        // time. We also use a list of deletions instead of erasing things
-        // itemwise.
-        //
-
-        auto r = toRemove.begin();
-        auto mark = _items.begin();
-        std::list<typename std::vector<T>::iterator> deleteList;
-
-        while (r != toRemove.end())
-        {
-            auto i = mark;
-            while (i != _items.end() && r != toRemove.end())
-            {
-                if (*r == *i)
-                {
-                    //
-                    // We want this list to be in LIFO order because we are
-                    // going to erase things from the tail forward.
-                    //
-                    deleteList.push_front(i);
-                    ++i;
-                    ++r;
-                    mark = i;
-                }
-                else
-                {
-                    ++i;
-                }
-            }
-
-            if (r == toRemove.end())
-            {
-                break;
-            }
-            ++r;
-        }
-
-        for (const auto& item : deleteList)
+        std::lock_guard lock(_mutex);
+        for (const auto& item : deletions)
         {
             _items.erase(item);
         }
@@ -138,8 +90,14 @@ namespace Glacier2
 
     template<class T, class P> std::vector<T> FilterT<T, P>::get(const Ice::Current&)
     {
-        std::lock_guard<std::mutex> lg(_mutex);
-        return _items;
+        std::vector<T> items;
+        {
+            std::shared_lock lock(_mutex);
+            items.assign(_items.begin(), _items.end());
+        }
+        // Return the items in a deterministic order.
+        sort(items.begin(), items.end());
+        return items;
     }
 
     using IdentitySetI = FilterT<Ice::Identity, Glacier2::IdentitySet>;
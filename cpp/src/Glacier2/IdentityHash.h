@@ -0,0 +1,24 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef GLACIER2_IDENTITY_HASH_H
+#define GLACIER2_IDENTITY_HASH_H
+
+#include "Ice/Identity.h"
+
+#include <functional>
+#include <string>
+
+namespace Glacier2
+{
+    // Hash function for the unordered containers keyed by Ice::Identity.
+    struct IdentityHash
+    {
+        size_t operator()(const Ice::Identity& ident) const noexcept
+        {
+            size_t h = std::hash<std::string>{}(ident.name);
+            return h ^ (std::hash<std::string>{}(ident.category) + 0x9e3779b9 + (h << 6) + (h >> 2));
+        }
+    };
+}
+
+#endif
@@ -158,6 +158,43 @@ Glacier2::Instance::Instance(
             "invalid value for Glacier2.AddConnectionContext: " + to_string(_addConnectionContext));
     }
 
+    int clientBatchInterval = _properties->getIcePropertyAsInt("Glacier2.Client.BatchInterval");
+    int serverBatchInterval = _properties->getIcePropertyAsInt("Glacier2.Server.BatchInterval");
+    if (clientBatchInterval < 0)
+    {
+        throw Ice::InitializationException(
+            __FILE__,
+            __LINE__,
+            "invalid value for Glacier2.Client.BatchInterval: " + to_string(clientBatchInterval));
+    }
+    if (serverBatchInterval < 0)
+    {
+        throw Ice::InitializationException(
+            __FILE__,
+            __LINE__,
+            "invalid value for Glacier2.Server.BatchInterval: " + to_string(serverBatchInterval));
+    }
+    if (clientBatchInterval > 0 || serverBatchInterval > 0)
+    {
+        _batchTimer = make_shared<IceInternal::Timer>();
+        if (clientBatchInterval > 0)
+        {
+            _clientBatcher = make_shared<RequestBatcher>(
+                _batchTimer,
+                chrono::milliseconds(clientBatchInterval),
+                _logger,
+                _clientRequestTraceLevel);
+        }
+        if (serverBatchInterval > 0)
+        {
+            _serverBatcher = make_shared<RequestBatcher>(
+                _batchTimer,
+                chrono::milliseconds(serverBatchInterval),
+                _logger,
+                _serverRequestTraceLevel);
+        }
+    }
+
     //
     // If an Ice metrics observer is setup on the communicator, also enable metrics for Glacier2.
     //
@@ -173,6 +210,19 @@ void
 Glacier2::Instance::destroy()
 {
     _sessionRouter = nullptr;
+
+    if (_clientBatcher)
+    {
+        _clientBatcher->destroy();
+    }
+    if (_serverBatcher)
+    {
+        _serverBatcher->destroy();
+    }
+    if (_batchTimer)
+    {
+        _batchTimer->destroy();
+    }
 }
 
 void
@@ -9,6 +9,7 @@
 #include "Ice/PropertiesF.h"
 #include "Instrumentation.h"
 #include "ProxyVerifier.h"
+#include "RequestBatcher.h"
 #include "SessionRouterI.h"
 
 #include <string>
@@ -38,6 +39,10 @@ namespace Glacier2
         [[nodiscard]] int clientRejectTraceLevel() const { return _clientRejectTraceLevel; }
         [[nodiscard]] int addConnectionContext() const { return _addConnectionContext; }
 
+        // The batchers used to forward oneway requests as batches, null when batching is disabled.
+        [[nodiscard]] std::shared_ptr<RequestBatcher> clientBatcher() const { return _clientBatcher; }
+        [[nodiscard]] std::shared_ptr<RequestBatcher> serverBatcher() const { return _serverBatcher; }
+
         // The session filter configuration, parsed from the Glacier2.Filter.* properties. Each session
         // seeds its own filters from these values.
         [[nodiscard]] const std::vector<std::string>& filterCategories() const { return _filterCategories; }
@@ -73,6 +78,9 @@ namespace Glacier2
         const std::vector<std::string> _filterAdapterIds;
         const std::vector<Ice::Identity> _filterIdentities;
         const int _filterAddUserMode;
+        IceInternal::TimerPtr _batchTimer;
+        std::shared_ptr<RequestBatcher> _clientBatcher;
+        std::shared_ptr<RequestBatcher> _serverBatcher;
         std::shared_ptr<SessionRouterI> _sessionRouter;
         const std::shared_ptr<Glacier2::Instrumentation::RouterObserver> _observer;
     };
@@ -10,6 +10,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace std;
@@ -604,28 +605,27 @@ namespace Glacier2
     }
 
     //
-    // A proxy validation rule encapsulating an address filter. An accept rule matches a proxy only when every
-    // endpoint matches it, while a reject rule matches a proxy as soon as one endpoint matches it
-    // (matchAnyEndpoint == true).
+    // An address filter: one of the rules of a Glacier2.Filter.Address.Accept or Glacier2.Filter.Address.Reject
+    // property. The rules are checked against the endpoints of a proxy by AddressRuleSet.
     //
-    class AddressRule final : public Glacier2::ProxyRule
+    class AddressRule final
     {
     public:
         AddressRule(
             CommunicatorPtr communicator,
             const vector<AddressMatcher*>& address,
             MatchesNumber* port,
-            const int traceLevel,
-            bool matchAnyEndpoint)
+            string exactHost,
+            const int traceLevel)
             : _communicator(std::move(communicator)),
               _addressRules(address),
               _portMatcher(port),
-              _traceLevel(traceLevel),
-              _matchAnyEndpoint(matchAnyEndpoint)
+              _exactHost(std::move(exactHost)),
+              _traceLevel(traceLevel)
         {
         }
 
-        ~AddressRule() override
+        ~AddressRule()
         {
             for (const auto& addressRule : _addressRules)
             {
@@ -634,36 +634,8 @@ namespace Glacier2
             delete _portMatcher;
         }
 
-        [[nodiscard]] bool check(const ObjectPrx& prx) const override
-        {
-            EndpointSeq endpoints = prx->ice_getEndpoints();
-            if (endpoints.size() == 0)
-            {
-                return false;
-            }
-            if (_matchAnyEndpoint)
-            {
-                for (const auto& endpoint : endpoints)
-                {
-                    if (matchEndpoint(endpoint))
-                    {
-                        return true;
-                    }
-                }
-                return false;
-            }
-            else
-            {
-                for (const auto& endpoint : endpoints)
-                {
-                    if (!matchEndpoint(endpoint))
-                    {
-                        return false;
-                    }
-                }
-                return true;
-            }
-        }
+        AddressRule(const AddressRule&) = delete;
+        AddressRule& operator=(const AddressRule&) = delete;
 
         void dump() const
         {
@@ -679,12 +651,14 @@ namespace Glacier2
             consoleErr << ")" << endl;
         }
 
-    private:
-        // Matches the host and port of endpoint against this rule.
-        [[nodiscard]] bool matchEndpoint(const EndpointPtr& endpoint) const
+        // The host matched by this rule when the rule's address has no wildcard and no group, empty otherwise.
+        [[nodiscard]] const string& exactHost() const { return _exactHost; }
+
+        // Extracts the host and port of endpoint, in the form matched by the rules. Returns false if the endpoint
+        // has no host or no port, in which case it matches no rule.
+        static bool parseEndpoint(const EndpointPtr& endpoint, string& host, string& port)
         {
             string info = endpoint->toString();
-            string host;
             if (!extractPart("-h ", info, host))
             {
                 return false;
@@ -699,12 +673,12 @@ namespace Glacier2
                 host.pop_back();
             }
 
-            string port;
-            if (!extractPart("-p ", info, port))
-            {
-                return false;
-            }
+            return extractPart("-p ", info, port);
+        }
 
+        // Matches a host and port extracted by parseEndpoint against this rule.
+        [[nodiscard]] bool matchHostAndPort(const string& host, const string& port) const
+        {
             string::size_type pos = 0;
             if (_portMatcher && !_portMatcher->match(port, pos))
             {
@@ -716,10 +690,16 @@ namespace Glacier2
                 return false;
             }
 
+            if (!_exactHost.empty())
+            {
+                return host == _exactHost;
+            }
+
             vector<bool> failed(_addressRules.size() * (host.size() + 1), false);
             return matchAddress(host, 0, 0, failed);
         }
 
+    private:
         // Matches host against the matchers at position index and up, starting at position pos in host. The
         // matchers must match the remainder of the host in full. When they don't, this function retries the
         // matchers that can match at a later position (the matchers created for the portion of a rule that
@@ -783,7 +763,138 @@ namespace Glacier2
         const CommunicatorPtr _communicator;
         vector<AddressMatcher*> _addressRules;
         MatchesNumber* _portMatcher;
+        const string _exactHost;
         const int _traceLevel;
+    };
+
+    //
+    // The address rules parsed from a Glacier2.Filter.Address.Accept or Glacier2.Filter.Address.Reject property. The
+    // rules whose address is a plain host name or IP address (the vast majority of large rule sets) are indexed by
+    // host, so checking an endpoint against them costs a hash lookup instead of a scan of every rule. Only the rules
+    // with wildcards or numeric groups are evaluated one by one. The host and port of each endpoint are extracted
+    // once per check rather than once per rule.
+    //
+    class AddressRuleSet final : public Glacier2::ProxyRule
+    {
+    public:
+        AddressRuleSet(vector<AddressRule*> rules, bool matchAnyEndpoint)
+            : _rules(std::move(rules)),
+              _matchAnyEndpoint(matchAnyEndpoint)
+        {
+            for (auto rule : _rules)
+            {
+                if (rule->exactHost().empty())
+                {
+                    _patternRules.push_back(rule);
+                }
+                else
+                {
+                    _exactHostRules[rule->exactHost()].push_back(rule);
+                }
+            }
+        }
+
+        ~AddressRuleSet() override
+        {
+            for (auto rule : _rules)
+            {
+                delete rule;
+            }
+        }
+
+        AddressRuleSet(const AddressRuleSet&) = delete;
+        AddressRuleSet& operator=(const AddressRuleSet&) = delete;
+
+        [[nodiscard]] bool check(const ObjectPrx& prx) const override
+        {
+            EndpointSeq endpoints = prx->ice_getEndpoints();
+            if (endpoints.empty())
+            {
+                return false;
+            }
+
+            if (_matchAnyEndpoint)
+            {
+                // The proxy matches as soon as one of its endpoints matches a rule.
+                for (const auto& endpoint : endpoints)
+                {
+                    string host;
+                    string port;
+                    if (AddressRule::parseEndpoint(endpoint, host, port))
+                    {
+                        vector<const AddressRule*> candidates = matchingRules(host, port);
+                        if (!candidates.empty())
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+            else
+            {
+                // The proxy matches when every endpoint matches the same rule: compute the rules matched by the
+                // first endpoint, then keep the ones that also match the other endpoints.
+                vector<const AddressRule*> candidates;
+                for (auto p = endpoints.begin(); p != endpoints.end(); ++p)
+                {
+                    string host;
+                    string port;
+                    if (!AddressRule::parseEndpoint(*p, host, port))
+                    {
+                        return false;
+                    }
+
+                    if (p == endpoints.begin())
+                    {
+                        candidates = matchingRules(host, port);
+                    }
+                    else
+                    {
+                        auto notMatching = [&host, &port](const AddressRule* rule)
+                        { return !rule->matchHostAndPort(host, port); };
+                        candidates.erase(
+                            remove_if(candidates.begin(), candidates.end(), notMatching),
+                            candidates.end());
+                    }
+
+                    if (candidates.empty())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+    private:
+        [[nodiscard]] vector<const AddressRule*> matchingRules(const string& host, const string& port) const
+        {
+            vector<const AddressRule*> result;
+            auto p = _exactHostRules.find(host);
+            if (p != _exactHostRules.end())
+            {
+                for (auto rule : p->second)
+                {
+                    if (rule->matchHostAndPort(host, port))
+                    {
+                        result.push_back(rule);
+                    }
+                }
+            }
+            for (auto rule : _patternRules)
+            {
+                if (rule->matchHostAndPort(host, port))
+                {
+                    result.push_back(rule);
+                }
+            }
+            return result;
+        }
+
+        const vector<AddressRule*> _rules;
+        unordered_map<string, vector<const AddressRule*>> _exactHostRules;
+        vector<const AddressRule*> _patternRules;
         const bool _matchAnyEndpoint;
     };
 
@@ -798,7 +909,7 @@ namespace Glacier2
         WildCardFactory wildCardFactory;
         EndsWithFactory endsWithFactory;
         FollowingFactory followingFactory;
-        vector<ProxyRule*> allRules;
+        vector<AddressRule*> allRules;
         try
         {
             istringstream propertyInput(property);
@@ -963,8 +1074,14 @@ namespace Glacier2
                         currentRuleSet.push_back(new MatchesAny);
                     }
                 }
-                allRules.push_back(
-                    new AddressRule(communicator, currentRuleSet, portMatch, traceLevel, matchAnyEndpoint));
+                // An address without wildcard and group matches a single host.
+                string exactHost = addr.find_first_of("*[]") == string::npos ? addr : string{};
+                allRules.push_back(new AddressRule(
+                    communicator,
+                    currentRuleSet,
+                    portMatch,
+                    std::move(exactHost),
+                    traceLevel));
             }
         }
         catch (...)
@@ -975,7 +1092,7 @@ namespace Glacier2
             }
             throw;
         }
-        rules = allRules;
+        rules.push_back(new AddressRuleSet(std::move(allRules), matchAnyEndpoint));
     }
 
     //
@@ -0,0 +1,300 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "RequestBatcher.h"
+
+using namespace std;
+using namespace Ice;
+using namespace Glacier2;
+
+namespace
+{
+    // The maximum number of proxies in the connection cache. The cache is cleared when it's full, the connections
+    // are then retrieved again on the next requests.
+    const size_t maxCachedConnections = 1000;
+}
+
+Glacier2::RequestBatcher::RequestBatcher(
+    IceInternal::TimerPtr timer,
+    chrono::milliseconds interval,
+    LoggerPtr logger,
+    int traceLevel)
+    : _timer(std::move(timer)),
+      _interval(interval),
+      _logger(std::move(logger)),
+      _traceLevel(traceLevel)
+{
+}
+
+void
+Glacier2::RequestBatcher::invoke(
+    const ObjectPrx& proxy,
+    const ConnectionPtr& connection,
+    string_view operation,
+    OperationMode mode,
+    pair<const byte*, const byte*> inParams,
+    const Context& context,
+    ResponseCallback response,
+    ExceptionCallback exception)
+{
+    assert(proxy->ice_isOneway() || proxy->ice_isDatagram());
+
+    if (connection)
+    {
+        try
+        {
+            queue(proxy, connection, operation, mode, inParams, context, std::move(response), exception);
+        }
+        catch (const LocalException&)
+        {
+            exception(current_exception());
+        }
+        return;
+    }
+
+    // The batch requests of a routable proxy are queued on the proxy itself, not on its connection. We queue the
+    // request on a proxy bound to the connection of the proxy instead, so that the requests for all the objects
+    // reached through this connection end up in the same batch.
+    ConnectionPtr cached;
+    {
+        lock_guard lock(_mutex);
+        auto p = _connectionCache.find(proxy);
+        if (p != _connectionCache.end())
+        {
+            cached = p->second;
+        }
+    }
+
+    if (cached)
+    {
+        try
+        {
+            queue(proxy->ice_fixed(cached), cached, operation, mode, inParams, context, response, exception);
+            return;
+        }
+        catch (const LocalException&)
+        {
+            // The cached connection is closed, retrieve the connection of the proxy again.
+            lock_guard lock(_mutex);
+            auto p = _connectionCache.find(proxy);
+            if (p != _connectionCache.end() && p->second == cached)
+            {
+                _connectionCache.erase(p);
+            }
+        }
+    }
+
+    // The connection is usually already established, but the callback can still be called from another thread: copy
+    // the in-parameters.
+    auto self = shared_from_this();
+    proxy->ice_getConnectionAsync(
+        [self,
+         proxy,
+         op = string{operation},
+         mode,
+         params = vector<byte>{inParams.first, inParams.second},
+         context,
+         response,
+         exception](const ConnectionPtr& con)
+        {
+            pair<const byte*, const byte*> paramsRange{params.data(), params.data() + params.size()};
+            if (con)
+            {
+                {
+                    lock_guard lock(self->_mutex);
+                    if (self->_connectionCache.size() >= maxCachedConnections)
+                    {
+                        self->_connectionCache.clear();
+                    }
+                    self->_connectionCache[proxy] = con;
+                }
+
+                try
+                {
+                    self->queue(proxy->ice_fixed(con), con, op, mode, paramsRange, context, response, exception);
+                }
+                catch (const LocalException&)
+                {
+                    exception(current_exception());
+                }
+            }
+            else
+            {
+                // Collocated target: there is no connection to batch requests on.
+                proxy->ice_invokeAsync(
+                    op,
+                    mode,
+                    paramsRange,
+                    nullptr,
+                    exception,
+                    [response](bool) { response(true, {nullptr, nullptr}); },
+                    context);
+            }
+        },
+        exception);
+}
+
+void
+Glacier2::RequestBatcher::flush(const ObjectPrx& proxy, const ConnectionPtr& connection)
+{
+    ConnectionPtr target = connection;
+    shared_ptr<PendingDispatches> pending;
+    {
+        lock_guard lock(_mutex);
+        if (_batches.empty())
+        {
+            return;
+        }
+
+        if (!target)
+        {
+            // The oneway requests for this proxy are queued on the connection cached for its oneway version.
+            auto p = _connectionCache.find(proxy->ice_oneway());
+            if (p == _connectionCache.end())
+            {
+                return;
+            }
+            target = p->second;
+        }
+
+        auto p = _batches.find(target);
+        if (p == _batches.end())
+        {
+            return;
+        }
+        pending = std::move(p->second);
+        _batches.erase(p);
+    }
+
+    // The flush is sent before the twoway request the caller forwards next.
+    flush(target, std::move(pending));
+}
+
+void
+Glacier2::RequestBatcher::destroy()
+{
+    unordered_map<ConnectionPtr, shared_ptr<PendingDispatches>> batches;
+    {
+        lock_guard lock(_mutex);
+        _destroyed = true;
+        batches.swap(_batches);
+        _connectionCache.clear();
+    }
+
+    // Don't lose the requests queued since the last flush.
+    for (const auto& [connection, pending] : batches)
+    {
+        flush(connection, pending);
+    }
+}
+
+void
+Glacier2::RequestBatcher::queue(
+    const ObjectPrx& proxy,
+    const ConnectionPtr& connection,
+    string_view operation,
+    OperationMode mode,
+    pair<const byte*, const byte*> inParams,
+    const Context& context,
+    ResponseCallback response,
+    ExceptionCallback exception)
+{
+    // Invoking on a batch proxy bound to a connection only queues the request on this connection. This throws if
+    // the connection is closed.
+    auto batchProxy = proxy->ice_isDatagram() ? proxy->ice_batchDatagram() : proxy->ice_batchOneway();
+    vector<byte> outParams;
+    batchProxy->ice_invoke(operation, mode, inParams, outParams, context);
+
+    shared_ptr<PendingDispatches> flushNow;
+    {
+        lock_guard lock(_mutex);
+        if (_destroyed)
+        {
+            // Flush right away, there is no timer anymore.
+            flushNow = make_shared<PendingDispatches>();
+            flushNow->push_back({std::move(response), std::move(exception)});
+        }
+        else
+        {
+            auto& pending = _batches[connection];
+            if (!pending)
+            {
+                pending = make_shared<PendingDispatches>();
+            }
+            pending->push_back({std::move(response), std::move(exception)});
+
+            if (!_flushScheduled)
+            {
+                _flushScheduled = true;
+                auto self = shared_from_this();
+                _timer->schedule([self] { self->flush(); }, _interval);
+            }
+        }
+    }
+
+    if (flushNow)
+    {
+        flush(connection, flushNow);
+    }
+}
+
+void
+Glacier2::RequestBatcher::flush()
+{
+    unordered_map<ConnectionPtr, shared_ptr<PendingDispatches>> batches;
+    {
+        lock_guard lock(_mutex);
+        _flushScheduled = false;
+        batches.swap(_batches);
+    }
+
+    for (const auto& [connection, pending] : batches)
+    {
+        flush(connection, pending);
+    }
+}
+
+void
+Glacier2::RequestBatcher::flush(const ConnectionPtr& connection, shared_ptr<PendingDispatches> pending)
+{
+    // The dispatches of the batched requests complete once the batch is sent, or with the flush failure. The requests
+    // auto-flushed with Ice.BatchAutoFlushSize are already sent, and complete with this flush.
+    auto failed = [logger = _logger, traceLevel = _traceLevel, pending](exception_ptr ex)
+    {
+        if (traceLevel >= 1)
+        {
+            try
+            {
+                rethrow_exception(ex);
+            }
+            catch (const std::exception& e)
+            {
+                Trace out(logger, "Glacier2");
+                out << "failed to flush batch requests:\n" << e;
+            }
+        }
+
+        for (const auto& dispatch : *pending)
+        {
+            dispatch.exception(ex);
+        }
+    };
+
+    try
+    {
+        connection->flushBatchRequestsAsync(
+            CompressBatch::BasedOnProxy,
+            failed,
+            [pending](bool)
+            {
+                for (const auto& dispatch : *pending)
+                {
+                    dispatch.response(true, {nullptr, nullptr});
+                }
+            });
+    }
+    catch (const LocalException&)
+    {
+        // The flush failed synchronously, for example because the communicator is being destroyed.
+        failed(current_exception());
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef GLACIER2_REQUEST_BATCHER_H
+#define GLACIER2_REQUEST_BATCHER_H
+
+#include "../Ice/Timer.h"
+#include "Ice/Ice.h"
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Glacier2
+{
+    // Forwards oneway and datagram requests as batch requests, grouped per target connection. The batch of a
+    // connection is flushed at most BatchInterval milliseconds after its first request is queued (or earlier, when
+    // it reaches Ice.BatchAutoFlushSize). This replaces one write per forwarded request with one write per batch.
+    // Enabled with Glacier2.Client.BatchInterval and Glacier2.Server.BatchInterval.
+    class RequestBatcher final : public std::enable_shared_from_this<RequestBatcher>
+    {
+    public:
+        using ResponseCallback = std::function<void(bool, std::pair<const std::byte*, const std::byte*>)>;
+        using ExceptionCallback = std::function<void(std::exception_ptr)>;
+
+        RequestBatcher(IceInternal::TimerPtr, std::chrono::milliseconds, Ice::LoggerPtr, int);
+
+        // Queues a request for proxy, a oneway or datagram proxy. connection is the connection proxy is bound to,
+        // if any. Otherwise, the request is queued on the connection that proxy would use. As for a forwarded oneway
+        // request, response is called once the request is sent, that is once its batch is flushed; this preserves
+        // the flow control through the router.
+        void invoke(
+            const Ice::ObjectPrx& proxy,
+            const Ice::ConnectionPtr& connection,
+            std::string_view operation,
+            Ice::OperationMode mode,
+            std::pair<const std::byte*, const std::byte*> inParams,
+            const Ice::Context& context,
+            ResponseCallback response,
+            ExceptionCallback exception);
+
+        // Flushes the requests queued on the connection of proxy, a twoway proxy, or on connection if not null. Called
+        // before forwarding a twoway request, so that it doesn't overtake the oneway requests forwarded before it.
+        void flush(const Ice::ObjectPrx& proxy, const Ice::ConnectionPtr& connection);
+
+        void destroy();
+
+    private:
+        struct PendingDispatch
+        {
+            ResponseCallback response;
+            ExceptionCallback exception;
+        };
+        using PendingDispatches = std::vector<PendingDispatch>;
+
+        void queue(
+            const Ice::ObjectPrx&,
+            const Ice::ConnectionPtr&,
+            std::string_view,
+            Ice::OperationMode,
+            std::pair<const std::byte*, const std::byte*>,
+            const Ice::Context&,
+            ResponseCallback,
+            ExceptionCallback);
+
+        void flush();
+        void flush(const Ice::ConnectionPtr&, std::shared_ptr<PendingDispatches>);
+
+        const IceInternal::TimerPtr _timer;
+        const std::chrono::milliseconds _interval;
+        const Ice::LoggerPtr _logger;
+        const int _traceLevel;
+
+        std::mutex _mutex;
+        // The connections with queued batch requests, and the dispatches of these requests.
+        std::unordered_map<Ice::ConnectionPtr, std::shared_ptr<PendingDispatches>> _batches;
+        // The connections used by routable proxies, to avoid retrieving the connection of the proxy for each request.
+        std::unordered_map<Ice::ObjectPrx, Ice::ConnectionPtr> _connectionCache;
+        bool _flushScheduled{false};
+        bool _destroyed{false};
+    };
+}
+
+#endif
@@ -22,7 +22,7 @@ Glacier2::RoutingTable::RoutingTable(
 void
 Glacier2::RoutingTable::destroy()
 {
-    lock_guard<mutex> lock(_mutex);
+    lock_guard lock(_mutex);
     if (_observer)
     {
         _observer->routingTableSize(-static_cast<int>(_map.size()));
@@ -36,7 +36,7 @@ Glacier2::RoutingTable::updateObserver(
     const string& userId,
     const shared_ptr<Ice::Connection>& connection)
 {
-    lock_guard<mutex> lock(_mutex);
+    lock_guard lock(_mutex);
     _observer.attach(obsv->getSessionObserver(userId, connection, static_cast<int>(_map.size()), _observer.get()));
     return _observer.get();
 }
@@ -46,7 +46,7 @@ Glacier2::RoutingTable::add(
     ObjectProxySeq unfiltered, // NOLINT(performance-unnecessary-value-param)
     const Current& current)
 {
-    lock_guard<mutex> lock(_mutex);
+    lock_guard lock(_mutex);
 
     size_t sz = _map.size();
 
@@ -85,9 +85,8 @@ Glacier2::RoutingTable::add(
                 out << "adding proxy to routing table:\n" << proxy;
             }
 
-            p = _map.insert(_map.begin(), make_pair(proxy->ice_getIdentity(), EvictorEntry{proxy, _queue.end()}));
-            auto q = _queue.insert(_queue.end(), p);
-            p->second.pos = q;
+            auto q = _queue.emplace(_queue.end(), proxy->ice_getIdentity(), proxy);
+            _map.emplace(q->id, q);
         }
         else
         {
@@ -99,25 +98,30 @@ Glacier2::RoutingTable::add(
                 out << "proxy already in routing table:\n" << proxy;
             }
 
-            auto& entry = p->second;
-            _queue.erase(entry.pos);
-            auto q = _queue.insert(_queue.end(), p);
-            entry.pos = q;
+            _queue.splice(_queue.end(), _queue, p->second);
+            p->second->referenced.store(true, memory_order_relaxed);
         }
 
         while (static_cast<int>(_map.size()) > _maxSize)
         {
-            p = _queue.front();
+            auto& entry = _queue.front();
+
+            // Give the entries used since they were last queued a second chance.
+            if (entry.referenced.exchange(false, memory_order_relaxed))
+            {
+                _queue.splice(_queue.end(), _queue, _queue.begin());
+                continue;
+            }
 
             if (_traceLevel >= 2)
             {
                 Trace out(_communicator->getLogger(), "Glacier2");
-                out << "evicting proxy from routing table:\n" << p->second.proxy;
+                out << "evicting proxy from routing table:\n" << entry.proxy;
             }
 
-            evictedProxies.emplace_back(p->second.proxy);
+            evictedProxies.emplace_back(entry.proxy);
 
-            _map.erase(p);
+            _map.erase(entry.id);
             _queue.pop_front();
         }
     }
@@ -133,7 +137,7 @@ Glacier2::RoutingTable::add(
 optional<ObjectPrx>
 Glacier2::RoutingTable::get(const Identity& ident)
 {
-    lock_guard<mutex> lock(_mutex);
+    shared_lock lock(_mutex);
 
     auto p = _map.find(ident);
 
@@ -143,11 +147,12 @@ Glacier2::RoutingTable::get(const Identity& ident)
     }
     else
     {
-        auto& entry = p->second;
-        _queue.erase(entry.pos);
-        auto q = _queue.insert(_queue.end(), p);
-        entry.pos = q;
-
+        // Only mark the entry as referenced: the eviction queue is updated by add() when it evicts proxies.
+        auto& entry = *p->second;
+        if (!entry.referenced.load(memory_order_relaxed))
+        {
+            entry.referenced.store(true, memory_order_relaxed);
+        }
         return entry.proxy;
     }
 }
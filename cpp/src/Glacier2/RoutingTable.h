@@ -5,11 +5,14 @@
 
 #include "Ice/Ice.h"
 #include "Ice/ObserverHelper.h"
+#include "IdentityHash.h"
 #include "Instrumentation.h"
 #include "ProxyVerifier.h"
 
+#include <atomic>
 #include <list>
-#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Glacier2
 {
@@ -35,23 +38,28 @@ namespace Glacier2
         const int _maxSize;
         const std::shared_ptr<ProxyVerifier> _verifier;
 
-        struct EvictorEntry;
-        using EvictorMap = std::map<Ice::Identity, EvictorEntry>;
-        using EvictorQueue = std::list<EvictorMap::iterator>;
-
-        friend struct EvictorEntry;
+        // The routing table is a hash map indexing an eviction queue. get() is called for every request forwarded by
+        // the ClientBlobject, so it only takes a shared lock and marks the entry as referenced instead of moving it
+        // to the back of the queue; add() gives referenced entries a second chance when it evicts. This approximates
+        // LRU eviction with O(1) lookups and O(1) amortized evictions.
         struct EvictorEntry
         {
-            Ice::ObjectPrx proxy;
-            EvictorQueue::iterator pos;
+            EvictorEntry(Ice::Identity id, Ice::ObjectPrx proxy) : id(std::move(id)), proxy(std::move(proxy)) {}
+
+            const Ice::Identity id;
+            const Ice::ObjectPrx proxy;
+            std::atomic<bool> referenced{false};
         };
 
+        using EvictorQueue = std::list<EvictorEntry>;
+        using EvictorMap = std::unordered_map<Ice::Identity, EvictorQueue::iterator, IdentityHash>;
+
         EvictorMap _map;
         EvictorQueue _queue;
 
         IceInternal::ObserverHelperT<Glacier2::Instrumentation::SessionObserver> _observer;
 
-        std::mutex _mutex;
+        std::shared_mutex _mutex;
     };
 }
 
@@ -422,7 +422,7 @@ CreateSession::create()
     }
     catch (...)
     {
-        // This CreateSession is not in _pending: just send the reply.
+        // This CreateSession is not pending: just send the reply.
         finished(current_exception());
         return;
     }
@@ -631,37 +631,50 @@ SessionRouterI::SessionRouterI(
       _verifier(std::move(verifier)),
       _sessionManager(std::move(sessionManager)),
       _sslVerifier(std::move(sslVerifier)),
-      _sslSessionManager(std::move(sslSessionManager)),
-      _routersByConnectionHint(_routersByConnection.cend()),
-      _routersByCategoryHint(_routersByCategory.cend())
+      _sslSessionManager(std::move(sslSessionManager))
 {
 }
 
 SessionRouterI::~SessionRouterI()
 {
-    lock_guard<mutex> lg(_mutex);
-
     assert(_destroy);
-    assert(_routersByConnection.empty());
-    assert(_routersByCategory.empty());
-    assert(_pending.empty());
+#ifndef NDEBUG
+    for (const auto& shard : _connectionShards)
+    {
+        assert(shard.routers.empty());
+        assert(shard.pending.empty());
+    }
+    for (const auto& shard : _categoryShards)
+    {
+        assert(shard.routers.empty());
+    }
+#endif
 }
 
 void
 SessionRouterI::destroy()
 {
-    map<ConnectionPtr, shared_ptr<RouterI>> routers;
+    bool destroyed = _destroy.exchange(true);
+    assert(!destroyed);
+    (void)destroyed;
+
+    // Once _destroy is set, finishCreateSession no longer adds routers: a router added before is found below since
+    // finishCreateSession adds it with the lock of its connection shard held.
+    vector<shared_ptr<RouterI>> routers;
+    for (auto& shard : _connectionShards)
     {
-        lock_guard<mutex> lg(_mutex);
-
-        assert(!_destroy);
-        _destroy = true;
-
-        _routersByConnection.swap(routers);
-        _routersByConnectionHint = _routersByConnection.cend();
+        unique_lock lock(shard.mutex);
+        for (const auto& [connection, router] : shard.routers)
+        {
+            routers.push_back(router);
+        }
+        shard.routers.clear();
+    }
 
-        _routersByCategory.clear();
-        _routersByCategoryHint = _routersByCategory.cend();
+    for (auto& shard : _categoryShards)
+    {
+        unique_lock lock(shard.mutex);
+        shard.routers.clear();
     }
 
     //
@@ -670,7 +683,7 @@ SessionRouterI::destroy()
     //
     for (const auto& router : routers)
     {
-        router.second->destroy([self = shared_from_this()](exception_ptr e) { self->sessionDestroyException(e); });
+        router->destroy([self = shared_from_this()](exception_ptr e) { self->sessionDestroyException(e); });
     }
 }
 
@@ -851,40 +864,30 @@ SessionRouterI::destroySession(const ConnectionPtr& connection, function<void(ex
     shared_ptr<RouterI> router;
 
     {
-        lock_guard<mutex> lg(_mutex);
+        auto& shard = connectionShard(connection);
+        unique_lock lock(shard.mutex);
 
         if (_destroy)
         {
             throw ObjectNotExistException{__FILE__, __LINE__};
         }
 
-        map<ConnectionPtr, shared_ptr<RouterI>>::const_iterator p;
-
-        if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if (p == _routersByConnection.cend())
+        auto p = shard.routers.find(connection);
+        if (p == shard.routers.end())
         {
             throw SessionNotExistException();
         }
 
-        router = p->second;
-
-        _routersByConnection.erase(p++);
-        _routersByConnectionHint = p;
+        router = std::move(p->second);
+        shard.routers.erase(p);
 
         if (_instance->serverObjectAdapter())
         {
             string category = router->serverProxy()->ice_getIdentity().category;
             assert(!category.empty());
-            _routersByCategory.erase(category);
-            _routersByCategoryHint = _routersByCategory.cend();
+            auto& catShard = categoryShard(category);
+            unique_lock catLock(catShard.mutex);
+            catShard.routers.erase(category);
         }
     }
 
@@ -936,51 +939,75 @@ SessionRouterI::getACMTimeout() const
 void
 SessionRouterI::updateSessionObservers()
 {
-    lock_guard<mutex> lg(_mutex);
-
     const auto& observer = _instance->getObserver();
     assert(observer);
 
-    for (const auto& router : _routersByConnection)
+    for (const auto& shard : _connectionShards)
     {
-        router.second->updateObserver(observer);
+        shared_lock lock(shard.mutex);
+        for (const auto& [connection, router] : shard.routers)
+        {
+            router->updateObserver(observer);
+        }
     }
 }
 
 shared_ptr<RouterI>
 SessionRouterI::getRouter(const ConnectionPtr& connection, const Ice::Identity& id, bool close) const
 {
-    lock_guard<mutex> lg(_mutex);
-    return getRouterImpl(connection, id, close);
+    //
+    // The connection can be null if the client tries to forward requests to
+    // a proxy which points to the client endpoints (in which case the request
+    // is forwarded with collocation optimization).
+    //
+    if (_destroy || !connection)
+    {
+        throw ObjectNotExistException{__FILE__, __LINE__};
+    }
+
+    {
+        const auto& shard = connectionShard(connection);
+        shared_lock lock(shard.mutex);
+        auto p = shard.routers.find(connection);
+        if (p != shard.routers.end())
+        {
+            return p->second;
+        }
+    }
+
+    if (close)
+    {
+        if (_rejectTraceLevel >= 1)
+        {
+            Trace out(_instance->logger(), "Glacier2");
+            out << "rejecting request, no session is associated with the connection.\n";
+            out << "identity: " << identityToString(id);
+        }
+        connection->abort();
+        throw ObjectNotExistException{__FILE__, __LINE__};
+    }
+    return nullptr;
 }
 
 ObjectPtr
 SessionRouterI::getClientBlobject(const ConnectionPtr& connection, const Ice::Identity& id) const
 {
-    lock_guard<mutex> lg(_mutex);
-    return getRouterImpl(connection, id, true)->getClientBlobject();
+    return getRouter(connection, id, true)->getClientBlobject();
 }
 
 ObjectPtr
 SessionRouterI::getServerBlobject(const string& category) const
 {
-    lock_guard<mutex> lg(_mutex);
-
     if (_destroy)
     {
         throw ObjectNotExistException{__FILE__, __LINE__};
     }
 
-    if (_routersByCategoryHint != _routersByCategory.cend() && _routersByCategoryHint->first == category)
-    {
-        return _routersByCategoryHint->second->getServerBlobject();
-    }
-
-    auto p = _routersByCategory.find(category);
-
-    if (p != _routersByCategory.cend())
+    const auto& shard = categoryShard(category);
+    shared_lock lock(shard.mutex);
+    auto p = shard.routers.find(category);
+    if (p != shard.routers.end())
     {
-        _routersByCategoryHint = p;
         return p->second->getServerBlobject();
     }
     else
@@ -989,43 +1016,20 @@ SessionRouterI::getServerBlobject(const string& category) const
     }
 }
 
-shared_ptr<RouterI>
-SessionRouterI::getRouterImpl(const ConnectionPtr& connection, const Ice::Identity& id, bool close) const
+SessionRouterI::ConnectionShard&
+SessionRouterI::connectionShard(const ConnectionPtr& connection) const
 {
-    //
-    // The connection can be null if the client tries to forward requests to
-    // a proxy which points to the client endpoints (in which case the request
-    // is forwarded with collocation optimization).
-    //
-    if (_destroy || !connection)
-    {
-        throw ObjectNotExistException{__FILE__, __LINE__};
-    }
-
-    if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
-    {
-        return _routersByConnectionHint->second;
-    }
-
-    auto p = _routersByConnection.find(connection);
+    // Mix the bits of the connection address, its low-order bits are always 0.
+    auto h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(connection.get()));
+    h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return _connectionShards[h % ShardCount];
+}
 
-    if (p != _routersByConnection.cend())
-    {
-        _routersByConnectionHint = p;
-        return p->second;
-    }
-    else if (close)
-    {
-        if (_rejectTraceLevel >= 1)
-        {
-            Trace out(_instance->logger(), "Glacier2");
-            out << "rejecting request, no session is associated with the connection.\n";
-            out << "identity: " << identityToString(id);
-        }
-        connection->abort();
-        throw ObjectNotExistException{__FILE__, __LINE__};
-    }
-    return nullptr;
+SessionRouterI::CategoryShard&
+SessionRouterI::categoryShard(const string& category) const
+{
+    return _categoryShards[hash<string>{}(category) % ShardCount];
 }
 
 void
@@ -1062,7 +1066,8 @@ SessionRouterI::sessionDestroyException(exception_ptr ex) const
 bool
 SessionRouterI::startCreateSession(const shared_ptr<CreateSession>& cb, const ConnectionPtr& connection)
 {
-    lock_guard<mutex> lg(_mutex);
+    auto& shard = connectionShard(connection);
+    unique_lock lock(shard.mutex);
 
     if (_destroy)
     {
@@ -1072,25 +1077,13 @@ SessionRouterI::startCreateSession(const shared_ptr<CreateSession>& cb, const Co
     //
     // Check whether a session already exists for the connection.
     //
+    if (shard.routers.find(connection) != shard.routers.end())
     {
-        map<ConnectionPtr, shared_ptr<RouterI>>::const_iterator p;
-        if (_routersByConnectionHint != _routersByConnection.cend() && _routersByConnectionHint->first == connection)
-        {
-            p = _routersByConnectionHint;
-        }
-        else
-        {
-            p = _routersByConnection.find(connection);
-        }
-
-        if (p != _routersByConnection.cend())
-        {
-            throw CannotCreateSessionException("session exists");
-        }
+        throw CannotCreateSessionException("session exists");
     }
 
-    auto p = _pending.find(connection);
-    if (p != _pending.end())
+    auto p = shard.pending.find(connection);
+    if (p != shard.pending.end())
     {
         //
         // If some other thread is currently trying to create a
@@ -1104,9 +1097,9 @@ SessionRouterI::startCreateSession(const shared_ptr<CreateSession>& cb, const Co
         //
         // No session exists yet, so we will try to create one. To
         // prevent other threads from creating a session for the
-        // same connection, we add our connection to _pending.
+        // same connection, we add our connection to the pending map.
         //
-        _pending.insert(make_pair(connection, cb));
+        shard.pending.insert(make_pair(connection, cb));
         return true;
     }
 }
@@ -1114,13 +1107,14 @@ SessionRouterI::startCreateSession(const shared_ptr<CreateSession>& cb, const Co
 void
 SessionRouterI::finishCreateSession(const ConnectionPtr& connection, const shared_ptr<RouterI>& router)
 {
-    lock_guard<mutex> lg(_mutex);
+    auto& shard = connectionShard(connection);
+    unique_lock lock(shard.mutex);
 
     //
     // Signal other threads that we are done with trying to
     // establish a session for our connection;
     //
-    _pending.erase(connection);
+    shard.pending.erase(connection);
 
     if (!router)
     {
@@ -1141,8 +1135,9 @@ SessionRouterI::finishCreateSession(const ConnectionPtr& connection, const share
         // to undo.
         string category = router->serverProxy()->ice_getIdentity().category;
         assert(!category.empty());
-        auto [pos, inserted] = _routersByCategory.insert({category, router});
-        if (!inserted)
+        auto& catShard = categoryShard(category);
+        unique_lock catLock(catShard.mutex);
+        if (!catShard.routers.insert({category, router}).second)
         {
             router->destroy(defaultSessionDestroyExceptionHandler());
 
@@ -1150,10 +1145,9 @@ SessionRouterI::finishCreateSession(const ConnectionPtr& connection, const share
             // UnknownException replies are logged by the default LoggerMiddleware.
             throw UnknownException{__FILE__, __LINE__, "duplicate client category"};
         }
-        _routersByCategoryHint = pos;
     }
 
-    _routersByConnectionHint = _routersByConnection.insert(_routersByConnectionHint, {connection, router});
+    shard.routers.insert({connection, router});
 
     connection->setCloseCallback(
         [self = shared_from_this()](const ConnectionPtr& c)
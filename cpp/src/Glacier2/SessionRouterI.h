@@ -8,8 +8,12 @@
 #include "Ice/Ice.h"
 #include "Instrumentation.h"
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Glacier2
 {
@@ -147,9 +151,6 @@ namespace Glacier2
     private:
         void sessionDestroyException(std::exception_ptr) const;
 
-        [[nodiscard]] std::shared_ptr<RouterI>
-        getRouterImpl(const Ice::ConnectionPtr&, const Ice::Identity&, bool) const;
-
         bool startCreateSession(const std::shared_ptr<CreateSession>&, const Ice::ConnectionPtr&);
         void finishCreateSession(const Ice::ConnectionPtr&, const std::shared_ptr<RouterI>&);
 
@@ -165,17 +166,32 @@ namespace Glacier2
         const std::optional<SSLPermissionsVerifierPrx> _sslVerifier;
         const std::optional<SSLSessionManagerPrx> _sslSessionManager;
 
-        std::map<Ice::ConnectionPtr, std::shared_ptr<RouterI>> _routersByConnection;
-        mutable std::map<Ice::ConnectionPtr, std::shared_ptr<RouterI>>::const_iterator _routersByConnectionHint;
+        // The sessions are partitioned into shards, each with its own lock, so that the creation, destruction and
+        // lookup of sessions established over different connections don't contend. The shard of a session is
+        // selected by its connection, and the shard of a server category by this category. When both are needed, the
+        // connection shard is always locked first.
+        static constexpr std::size_t ShardCount = 32;
+
+        struct ConnectionShard
+        {
+            std::unordered_map<Ice::ConnectionPtr, std::shared_ptr<RouterI>> routers;
+            std::unordered_map<Ice::ConnectionPtr, std::shared_ptr<CreateSession>> pending;
+            std::shared_mutex mutex;
+        };
 
-        std::map<std::string, std::shared_ptr<RouterI>> _routersByCategory;
-        mutable std::map<std::string, std::shared_ptr<RouterI>>::const_iterator _routersByCategoryHint;
+        struct CategoryShard
+        {
+            std::unordered_map<std::string, std::shared_ptr<RouterI>> routers;
+            std::shared_mutex mutex;
+        };
 
-        std::map<Ice::ConnectionPtr, std::shared_ptr<CreateSession>> _pending;
+        [[nodiscard]] ConnectionShard& connectionShard(const Ice::ConnectionPtr&) const;
+        [[nodiscard]] CategoryShard& categoryShard(const std::string&) const;
 
-        bool _destroy{false};
+        mutable std::array<ConnectionShard, ShardCount> _connectionShards;
+        mutable std::array<CategoryShard, ShardCount> _categoryShards;
 
-        mutable std::mutex _mutex;
+        std::atomic<bool> _destroy{false};
     };
 }
 
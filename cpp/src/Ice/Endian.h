@@ -37,4 +37,44 @@ namespace std
 
 #endif
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace IceInternal
+{
+    // Reverses the bytes of an unsigned integer.
+    template<typename T> constexpr T byteSwap(T v) noexcept
+    {
+        static_assert(std::is_unsigned_v<T>);
+        T result = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            result = static_cast<T>((result << 8) | (v & 0xff));
+            v = static_cast<T>(v >> 8);
+        }
+        return result;
+    }
+
+    // Copies count elements of the given size, reversing the bytes of each element. This converts a sequence between
+    // the Slice encoding (little-endian) and the native representation on a big-endian platform. Each element is
+    // swapped as a whole word, which compilers turn into byte-swap or vector shuffle instructions, unlike a byte by
+    // byte copy.
+    template<std::size_t size> void byteSwapCopy(std::byte* dest, const std::byte* src, std::size_t count) noexcept
+    {
+        static_assert(size == 2 || size == 4 || size == 8);
+        using Word =
+            std::conditional_t<size == 2, std::uint16_t, std::conditional_t<size == 4, std::uint32_t, std::uint64_t>>;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Word word;
+            std::memcpy(&word, src + i * size, size);
+            word = byteSwap(word);
+            std::memcpy(dest + i * size, &word, size);
+        }
+    }
+}
+
 #endif
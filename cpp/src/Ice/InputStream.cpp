@@ -537,10 +537,35 @@ namespace
         }
     };
 
+    // Checks that all the bytes are 0 or 1, the only byte values that are valid bool values. The bytes are checked 8
+    // at a time, with a loop that compilers vectorize.
+    bool isBoolEncoding(const byte* bytes, size_t sz)
+    {
+        uint64_t bits = 0;
+        size_t idx = 0;
+        for (; idx + sizeof(uint64_t) <= sz; idx += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, bytes + idx, sizeof(uint64_t));
+            bits |= word;
+        }
+        for (; idx < sz; ++idx)
+        {
+            bits |= static_cast<uint64_t>(bytes[idx]);
+        }
+        return (bits & ~uint64_t{0x0101010101010101}) == 0;
+    }
+
     template<> struct ReadBoolHelper<1>
     {
         static bool* read(pair<const bool*, const bool*>& v, int32_t sz, InputStream::Container::iterator& i)
         {
+            // A byte other than 0 or 1 isn't a valid bool: point into the buffer only if all the bytes are 0 or 1,
+            // and otherwise convert the bytes into a new array.
+            if (!isBoolEncoding(i, static_cast<size_t>(sz)))
+            {
+                return ReadBoolHelper<0>::read(v, sz, i);
+            }
             v.first = reinterpret_cast<bool*>(i);
             v.second = reinterpret_cast<bool*>(i) + sz;
             return nullptr;
@@ -601,14 +626,7 @@ Ice::InputStream::read(vector<int16_t>& v)
         v.resize(static_cast<size_t>(sz));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = &(*begin);
-            byte* dest = reinterpret_cast<byte*>(v.data()) + sizeof(int16_t) - 1;
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest-- = *src++;
-                *dest-- = *src++;
-                dest += 2 * sizeof(int16_t);
-            }
+            byteSwapCopy<sizeof(int16_t)>(reinterpret_cast<byte*>(v.data()), &(*begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -659,16 +677,7 @@ Ice::InputStream::read(vector<int32_t>& v)
         v.resize(static_cast<size_t>(sz));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = &(*begin);
-            byte* dest = reinterpret_cast<byte*>(v.data()) + sizeof(int32_t) - 1;
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                dest += 2 * sizeof(int32_t);
-            }
+            byteSwapCopy<sizeof(int32_t)>(reinterpret_cast<byte*>(v.data()), &(*begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -727,20 +736,7 @@ Ice::InputStream::read(vector<int64_t>& v)
         v.resize(static_cast<size_t>(sz));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = &(*begin);
-            byte* dest = reinterpret_cast<byte*>(v.data()) + sizeof(int64_t) - 1;
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                dest += 2 * sizeof(int64_t);
-            }
+            byteSwapCopy<sizeof(int64_t)>(reinterpret_cast<byte*>(v.data()), &(*begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -791,16 +787,7 @@ Ice::InputStream::read(vector<float>& v)
         v.resize(static_cast<size_t>(sz));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = &(*begin);
-            byte* dest = reinterpret_cast<byte*>(v.data()) + sizeof(float) - 1;
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                dest += 2 * sizeof(float);
-            }
+            byteSwapCopy<sizeof(float)>(reinterpret_cast<byte*>(v.data()), &(*begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -859,20 +846,7 @@ Ice::InputStream::read(vector<double>& v)
         v.resize(static_cast<size_t>(sz));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = &(*begin);
-            byte* dest = reinterpret_cast<byte*>(v.data()) + sizeof(double) - 1;
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                *dest-- = *src++;
-                dest += 2 * sizeof(double);
-            }
+            byteSwapCopy<sizeof(double)>(reinterpret_cast<byte*>(v.data()), &(*begin), static_cast<size_t>(sz));
         }
         else
         {
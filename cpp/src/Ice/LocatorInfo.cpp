@@ -849,3 +849,38 @@ IceInternal::LocatorInfo::finishRequest(
         _objectRequests.erase(ref->getIdentity());
     }
 }
+
+void
+IceInternal::addToLocatorCache(
+    const LocatorPrx& locator,
+    const vector<pair<string, optional<ObjectPrx>>>& adapters,
+    const vector<pair<Identity, optional<ObjectPrx>>>& objects)
+{
+    InstancePtr instance = getInstance(locator->ice_getCommunicator());
+    LocatorTablePtr table = instance->locatorManager()->get(locator)->getTable();
+
+    size_t count = 0;
+    for (const auto& [adapterId, proxy] : adapters)
+    {
+        if (proxy && !proxy->_getReference()->isIndirect())
+        {
+            table->addAdapterEndpoints(adapterId, proxy->_getReference()->getEndpoints());
+            ++count;
+        }
+    }
+    for (const auto& [id, proxy] : objects)
+    {
+        if (proxy && !proxy->_getReference()->isWellKnown())
+        {
+            table->addObjectReference(id, proxy->_getReference());
+            ++count;
+        }
+    }
+
+    if (instance->traceLevels()->location >= 1)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "added " << count << " adapter endpoints and object references to the locator cache\n";
+        out << "locator = " << locator;
+    }
+}
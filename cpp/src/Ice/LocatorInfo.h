@@ -130,6 +130,7 @@ namespace IceInternal
         bool operator<(const LocatorInfo&) const;
 
         [[nodiscard]] Ice::LocatorPrx getLocator() const { return _locator; }
+        [[nodiscard]] const LocatorTablePtr& getTable() const { return _table; }
 
         std::optional<Ice::LocatorRegistryPrx> getLocatorRegistry();
 
@@ -171,6 +172,15 @@ namespace IceInternal
         std::map<Ice::Identity, RequestPtr> _objectRequests;
         std::mutex _mutex;
     };
+
+    //
+    // Adds the proxies returned by bulk locator requests to the locator cache of the given locator, like the proxies
+    // returned by findAdapterById and findObjectById. This is used by IceGrid to prefetch the locator cache.
+    //
+    ICE_API void addToLocatorCache(
+        const Ice::LocatorPrx&,
+        const std::vector<std::pair<std::string, std::optional<Ice::ObjectPrx>>>&,
+        const std::vector<std::pair<Ice::Identity, std::optional<Ice::ObjectPrx>>>&);
 }
 
 #endif
@@ -28,6 +28,7 @@ ios_excludes := $(wildcard $(addprefix $(currentdir)/,\
     CtrlCHandler.cpp \
     OutputUtil.cpp \
     Service.cpp \
+    Shm*.cpp \
     SysLoggerI.cpp \
     SystemdJournalI.cpp \
     Tcp*.cpp))
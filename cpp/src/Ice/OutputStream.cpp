@@ -449,14 +449,7 @@ Ice::OutputStream::write(const int16_t* begin, const int16_t* end)
         resize(pos + static_cast<size_t>(sz) * sizeof(int16_t));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = reinterpret_cast<const byte*>(begin) + sizeof(int16_t) - 1;
-            byte* dest = &(*(b.begin() + pos));
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest++ = *src--;
-                *dest++ = *src--;
-                src += 2 * sizeof(int16_t);
-            }
+            byteSwapCopy<sizeof(int16_t)>(&b[pos], reinterpret_cast<const byte*>(begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -497,16 +490,7 @@ Ice::OutputStream::write(const int32_t* begin, const int32_t* end)
         resize(pos + static_cast<size_t>(sz) * sizeof(int32_t));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = reinterpret_cast<const byte*>(begin) + sizeof(int32_t) - 1;
-            byte* dest = &(*(b.begin() + pos));
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                src += 2 * sizeof(int32_t);
-            }
+            byteSwapCopy<sizeof(int32_t)>(&b[pos], reinterpret_cast<const byte*>(begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -558,20 +542,7 @@ Ice::OutputStream::write(const int64_t* begin, const int64_t* end)
         resize(pos + static_cast<size_t>(sz) * sizeof(int64_t));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = reinterpret_cast<const byte*>(begin) + sizeof(int64_t) - 1;
-            byte* dest = &(*(b.begin() + pos));
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                src += 2 * sizeof(int64_t);
-            }
+            byteSwapCopy<sizeof(int64_t)>(&b[pos], reinterpret_cast<const byte*>(begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -615,16 +586,7 @@ Ice::OutputStream::write(const float* begin, const float* end)
         resize(pos + static_cast<size_t>(sz) * sizeof(float));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = reinterpret_cast<const byte*>(begin) + sizeof(float) - 1;
-            byte* dest = &(*(b.begin() + pos));
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                src += 2 * sizeof(float);
-            }
+            byteSwapCopy<sizeof(float)>(&b[pos], reinterpret_cast<const byte*>(begin), static_cast<size_t>(sz));
         }
         else
         {
@@ -676,20 +638,7 @@ Ice::OutputStream::write(const double* begin, const double* end)
         resize(pos + static_cast<size_t>(sz) * sizeof(double));
         if constexpr (endian::native == endian::big)
         {
-            const byte* src = reinterpret_cast<const byte*>(begin) + sizeof(double) - 1;
-            byte* dest = &(*(b.begin() + pos));
-            for (int j = 0; j < sz; ++j)
-            {
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                *dest++ = *src--;
-                src += 2 * sizeof(double);
-            }
+            byteSwapCopy<sizeof(double)>(&b[pos], reinterpret_cast<const byte*>(begin), static_cast<size_t>(sz));
         }
         else
         {
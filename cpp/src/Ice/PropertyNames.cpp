@@ -339,8 +339,10 @@ const Property IceGridPropsData[] =
     Property{"Node.AllowEndpointsOverride", "0", false, false, nullptr},
     Property{"Node.AllowRunningServersAsRoot", "", false, false, nullptr},
     Property{"Node.CollocateRegistry", "", false, false, nullptr},
+    Property{"Node.ConcurrentActivations", "0", false, false, nullptr},
     Property{"Node.Data", "", false, false, nullptr},
     Property{"Node.DisableOnFailure", "0", false, false, nullptr},
+    Property{"Node.LiveLoadPeriod", "0", false, false, nullptr},
     Property{"Node.Name", "", false, false, nullptr},
     Property{"Node.Output", "", false, false, nullptr},
     Property{"Node.PrintServersReady", "", false, false, nullptr},
@@ -372,6 +374,7 @@ const Property IceGridPropsData[] =
     Property{"Registry.Internal", "", false, false, &PropertyNames::ObjectAdapterProps},
     Property{"Registry.LMDB.Path", "", false, false, nullptr},
     Property{"Registry.LMDB.MapSize", "", false, false, nullptr},
+    Property{"Registry.NodeObserverUpdatePeriod", "0", false, false, nullptr},
     Property{"Registry.NodeSessionTimeout", "30", false, false, nullptr},
     Property{"Registry.PermissionsVerifier", "", false, false, &PropertyNames::ProxyProps},
     Property{"Registry.ReplicaName", "Master", false, false, nullptr},
@@ -402,7 +405,7 @@ const PropertyArray PropertyNames::IceGridProps
     .prefixOnly=false,
     .isOptIn=true,
     .properties=IceGridPropsData,
-    .length=60
+    .length=63
 };
 
 const PropertyArray PropertyNames::IceGridGUIProps
@@ -458,6 +461,7 @@ const Property IceStormPropsData[] =
     Property{"InstanceName", "IceStorm", false, false, nullptr},
     Property{"LMDB.Path", "IceStorm", false, false, nullptr},
     Property{"LMDB.MapSize", "", false, false, nullptr},
+    Property{"Multicast.*", "", true, false, nullptr},
     Property{"Node", "", false, false, &PropertyNames::ObjectAdapterProps},
     Property{"NodeId", "-1", false, false, nullptr},
     Property{"Nodes.*", "", true, false, nullptr},
@@ -483,7 +487,7 @@ const PropertyArray PropertyNames::IceStormProps
     .prefixOnly=false,
     .isOptIn=true,
     .properties=IceStormPropsData,
-    .length=25
+    .length=26
 };
 
 const Property IceStormAdminPropsData[] =
@@ -521,6 +525,7 @@ const Property Glacier2PropsData[] =
 {
     Property{"AddConnectionContext", "0", false, false, nullptr},
     Property{"Client", "", false, false, &PropertyNames::ObjectAdapterProps},
+    Property{"Client.BatchInterval", "0", false, false, nullptr},
     Property{"Client.ForwardContext", "0", false, false, nullptr},
     Property{"Client.Trace.Reject", "0", false, false, nullptr},
     Property{"Client.Trace.Request", "0", false, false, nullptr},
@@ -536,6 +541,7 @@ const Property Glacier2PropsData[] =
     Property{"PermissionsVerifier", "", false, false, &PropertyNames::ProxyProps},
     Property{"RoutingTable.MaxSize", "1000", false, false, nullptr},
     Property{"Server", "", false, false, &PropertyNames::ObjectAdapterProps},
+    Property{"Server.BatchInterval", "0", false, false, nullptr},
     Property{"Server.ForwardContext", "0", false, false, nullptr},
     Property{"Server.Trace.Request", "0", false, false, nullptr},
     Property{"SessionManager", "", false, false, &PropertyNames::ProxyProps},
@@ -551,12 +557,14 @@ const PropertyArray PropertyNames::Glacier2Props
     .prefixOnly=false,
     .isOptIn=true,
     .properties=Glacier2PropsData,
-    .length=24
+    .length=26
 };
 
 const Property DataStormPropsData[] =
 {
     Property{"Node.ConnectTo", "", false, false, nullptr},
+    Property{"Node.LMDB.MapSize", "", false, false, nullptr},
+    Property{"Node.LMDB.Path", "", false, false, nullptr},
     Property{"Node.Multicast", "", false, false, &PropertyNames::ObjectAdapterProps},
     Property{"Node.Multicast.Enabled", "1", false, false, nullptr},
     Property{"Node.Multicast.Proxy", "", false, false, &PropertyNames::ProxyProps},
@@ -567,8 +575,13 @@ const Property DataStormPropsData[] =
     Property{"Node.Server", "", false, false, &PropertyNames::ObjectAdapterProps},
     Property{"Node.Server.Enabled", "1", false, false, nullptr},
     Property{"Node.Server.ForwardDiscoveryToMulticast", "0", false, false, nullptr},
+    Property{"Node.Server.SharedMemory", "0", false, false, nullptr},
+    Property{"Topic.BatchInterval", "0", false, false, nullptr},
+    Property{"Topic.BatchSize", "0", false, false, nullptr},
     Property{"Topic.ClearHistory", "OnAll", false, false, nullptr},
+    Property{"Topic.DeltaKeyframeInterval", "0", false, false, nullptr},
     Property{"Topic.DiscardPolicy", "Never", false, false, nullptr},
+    Property{"Topic.HistoryCacheSize", "128", false, false, nullptr},
     Property{"Topic.Priority", "0", false, false, nullptr},
     Property{"Topic.SampleCount", "-1", false, false, nullptr},
     Property{"Topic.SampleLifetime", "0", false, false, nullptr},
@@ -583,7 +596,7 @@ const PropertyArray PropertyNames::DataStormProps
     .prefixOnly=false,
     .isOptIn=false,
     .properties=DataStormPropsData,
-    .length=19
+    .length=26
 };
 
 const std::array<PropertyArray, 16> PropertyNames::validProps =
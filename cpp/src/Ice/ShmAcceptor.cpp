@@ -0,0 +1,173 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmAcceptor.h"
+#    include "Ice/LocalExceptions.h"
+#    include "Ice/Properties.h"
+#    include "ProtocolInstance.h"
+#    include "ShmEndpointI.h"
+#    include "ShmTransceiver.h"
+
+#    include <cstring>
+#    include <sys/stat.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    sockaddr_un toSocketAddress(const string& path)
+    {
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path))
+        {
+            throw SocketException(__FILE__, __LINE__, ENAMETOOLONG);
+        }
+        memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        return addr;
+    }
+
+    // Creates the socket directory of the current user, or checks that the existing one is only accessible to us.
+    void createSocketDirectory()
+    {
+        const string directory = shmSocketDirectory();
+        if (::mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST)
+        {
+            throw SocketException(__FILE__, __LINE__, errno);
+        }
+
+        struct stat st;
+        if (::lstat(directory.c_str(), &st) != 0)
+        {
+            throw SocketException(__FILE__, __LINE__, errno);
+        }
+        if (!S_ISDIR(st.st_mode) || st.st_uid != ::geteuid() || (st.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+        {
+            throw SocketException(__FILE__, __LINE__, EACCES);
+        }
+    }
+}
+
+NativeInfoPtr
+IceInternal::ShmAcceptor::getNativeInfo()
+{
+    return shared_from_this();
+}
+
+void
+IceInternal::ShmAcceptor::close()
+{
+    if (_fd != INVALID_SOCKET)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+    }
+
+    if (_bound)
+    {
+        ::unlink(_path.c_str());
+        _bound = false;
+    }
+}
+
+EndpointIPtr
+IceInternal::ShmAcceptor::listen()
+{
+    sockaddr_un addr = toSocketAddress(_path);
+    createSocketDirectory();
+
+    // A socket file left behind by a server that didn't shut down cleanly prevents the bind: remove it, unless a
+    // server still accepts connections on it. Other files are never removed, the bind fails instead.
+    struct stat st;
+    SOCKET probe = ::lstat(_path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode) ? ::socket(AF_UNIX, SOCK_STREAM, 0)
+                                                                              : INVALID_SOCKET;
+    if (probe != INVALID_SOCKET)
+    {
+        bool inUse = ::connect(probe, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+        closeSocketNoThrow(probe);
+        if (inUse)
+        {
+            throw SocketException(__FILE__, __LINE__, EADDRINUSE);
+        }
+        ::unlink(_path.c_str());
+    }
+
+    if (::bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    _bound = true;
+
+    // The directory already restricts access, the socket is also made owner-only for good measure.
+    if (::chmod(_path.c_str(), S_IRUSR | S_IWUSR) != 0)
+    {
+        throw SocketException(__FILE__, __LINE__, errno);
+    }
+
+    try
+    {
+        doListen(_fd, _instance->properties()->getIcePropertyAsInt("Ice.TCP.Backlog"));
+    }
+    catch (...)
+    {
+        _fd = INVALID_SOCKET;
+        throw;
+    }
+    return _endpoint;
+}
+
+TransceiverPtr
+IceInternal::ShmAcceptor::accept()
+{
+    SOCKET fd;
+    while ((fd = ::accept(_fd, nullptr, nullptr)) == INVALID_SOCKET)
+    {
+        if (!acceptInterrupted())
+        {
+            throw SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+    }
+    setBlock(fd, false);
+    return make_shared<ShmTransceiver>(_instance, fd, _path);
+}
+
+string
+IceInternal::ShmAcceptor::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::ShmAcceptor::toString() const
+{
+    return _path;
+}
+
+string
+IceInternal::ShmAcceptor::toDetailedString() const
+{
+    return "local socket = " + _path;
+}
+
+IceInternal::ShmAcceptor::ShmAcceptor(shared_ptr<ShmEndpointI> endpoint, ProtocolInstancePtr instance, string path)
+    : NativeInfo(::socket(AF_UNIX, SOCK_STREAM, 0)),
+      _endpoint(std::move(endpoint)),
+      _instance(std::move(instance)),
+      _path(std::move(path))
+{
+    if (_fd == INVALID_SOCKET)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    setBlock(_fd, false);
+}
+
+IceInternal::ShmAcceptor::~ShmAcceptor() { assert(_fd == INVALID_SOCKET); }
+#endif
@@ -0,0 +1,36 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_ACCEPTOR_H
+#define ICE_SHM_ACCEPTOR_H
+
+#include "Acceptor.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class ShmEndpointI;
+
+    class ShmAcceptor final : public Acceptor, public NativeInfo, public std::enable_shared_from_this<ShmAcceptor>
+    {
+    public:
+        ShmAcceptor(std::shared_ptr<ShmEndpointI>, ProtocolInstancePtr, std::string);
+        ~ShmAcceptor() override;
+        NativeInfoPtr getNativeInfo() final;
+
+        void close() final;
+        EndpointIPtr listen() final;
+        TransceiverPtr accept() final;
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+
+    private:
+        const std::shared_ptr<ShmEndpointI> _endpoint;
+        const ProtocolInstancePtr _instance;
+        const std::string _path;
+        bool _bound{false};
+    };
+}
+#endif
@@ -0,0 +1,72 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmConnector.h"
+#    include "ProtocolInstance.h"
+#    include "ShmTransceiver.h"
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+TransceiverPtr
+IceInternal::ShmConnector::connect()
+{
+    return make_shared<ShmTransceiver>(_instance, _path);
+}
+
+int16_t
+IceInternal::ShmConnector::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::ShmConnector::toString() const
+{
+    return _path;
+}
+
+bool
+IceInternal::ShmConnector::operator==(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const ShmConnector*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+    return _path == p->_path && _connectionId == p->_connectionId;
+}
+
+bool
+IceInternal::ShmConnector::operator<(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const ShmConnector*>(&r);
+    if (!p)
+    {
+        return type() < r.type();
+    }
+
+    if (_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if (p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+    return _path < p->_path;
+}
+
+IceInternal::ShmConnector::ShmConnector(ProtocolInstancePtr instance, string path, string connectionId)
+    : _instance(std::move(instance)),
+      _path(std::move(path)),
+      _connectionId(std::move(connectionId))
+{
+}
+
+IceInternal::ShmConnector::~ShmConnector() = default;
+#endif
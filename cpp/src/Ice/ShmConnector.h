@@ -0,0 +1,32 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_CONNECTOR_H
+#define ICE_SHM_CONNECTOR_H
+
+#include "Connector.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class ShmConnector final : public Connector
+    {
+    public:
+        ShmConnector(ProtocolInstancePtr, std::string, std::string);
+        ~ShmConnector() override;
+        TransceiverPtr connect() final;
+
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] std::string toString() const final;
+
+        bool operator==(const Connector&) const final;
+        bool operator<(const Connector&) const final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+        const std::string _path;
+        const std::string _connectionId;
+    };
+}
+
+#endif
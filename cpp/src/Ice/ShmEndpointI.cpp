@@ -0,0 +1,439 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmEndpointI.h"
+#    include "HashUtil.h"
+#    include "Ice/InputStream.h"
+#    include "Ice/LocalExceptions.h"
+#    include "Ice/OutputStream.h"
+#    include "Ice/StringUtil.h"
+#    include "Ice/UUID.h"
+#    include "ProtocolInstance.h"
+#    include "ShmAcceptor.h"
+#    include "ShmConnector.h"
+
+#    include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    const char* const shmPluginName = "IceSHM";
+
+    // The name is part of a file name, see shmSocketPath.
+    bool isValidName(const string& name)
+    {
+        return !name.empty() && name.find_first_of(string{"/ \t\0", 4}) == string::npos;
+    }
+
+}
+
+//
+// Plug-in factory function. The plug-in isn't loaded by default: the application loads it with
+// Ice.Plugin.IceSHM=Ice:createIceSHM or with the factory returned by Ice::shmPluginFactory.
+//
+extern "C"
+{
+    ICE_API Plugin* createIceSHM(const CommunicatorPtr& c, const string& name, const StringSeq&)
+    {
+        string pluginName{shmPluginName};
+
+        if (name != pluginName)
+        {
+            throw PluginInitializationException{
+                __FILE__,
+                __LINE__,
+                "the shared memory plug-in must be named '" + pluginName + "'"};
+        }
+
+        return new EndpointFactoryPlugin(
+            c,
+            make_shared<ShmEndpointFactory>(make_shared<ProtocolInstance>(c, SHMEndpointType, "shm", false)));
+    }
+}
+
+Ice::PluginFactory
+Ice::shmPluginFactory()
+{
+    return {shmPluginName, createIceSHM};
+}
+
+IceInternal::ShmEndpointInfo::~ShmEndpointInfo() = default;
+
+IceInternal::ShmEndpointI::ShmEndpointI(ProtocolInstancePtr instance, string name, string connectionId, bool compress)
+    : _instance(std::move(instance)),
+      _name(std::move(name)),
+      _connectionId(std::move(connectionId)),
+      _compress(compress)
+{
+}
+
+IceInternal::ShmEndpointI::ShmEndpointI(ProtocolInstancePtr instance) : _instance(std::move(instance)), _compress(false)
+{
+}
+
+IceInternal::ShmEndpointI::ShmEndpointI(ProtocolInstancePtr instance, InputStream* s)
+    : _instance(std::move(instance)),
+      _compress(false)
+{
+    s->read(const_cast<string&>(_name), false);
+    s->read(const_cast<bool&>(_compress));
+
+    // The endpoint can come from a peer: it must not make us connect to another socket than an shm endpoint socket.
+    if (!isValidName(_name))
+    {
+        throw MarshalException{__FILE__, __LINE__, "invalid shm endpoint name '" + _name + "'"};
+    }
+}
+
+void
+IceInternal::ShmEndpointI::streamWriteImpl(OutputStream* s) const
+{
+    s->write(_name, false);
+    s->write(_compress);
+}
+
+EndpointInfoPtr
+IceInternal::ShmEndpointI::getInfo() const noexcept
+{
+    return make_shared<ShmEndpointInfo>(_compress, _name, type());
+}
+
+int16_t
+IceInternal::ShmEndpointI::type() const
+{
+    return _instance->type();
+}
+
+const string&
+IceInternal::ShmEndpointI::protocol() const
+{
+    return _instance->protocol();
+}
+
+int32_t
+IceInternal::ShmEndpointI::timeout() const
+{
+    return -1;
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::timeout(int32_t) const
+{
+    return const_cast<ShmEndpointI*>(this)->shared_from_this();
+}
+
+const string&
+IceInternal::ShmEndpointI::connectionId() const
+{
+    return _connectionId;
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::connectionId(const string& connectionId) const
+{
+    if (connectionId == _connectionId)
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _name, connectionId, _compress);
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::compress() const
+{
+    return _compress;
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::compress(bool compress) const
+{
+    if (compress == _compress)
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _name, _connectionId, compress);
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::datagram() const
+{
+    return false;
+}
+
+bool
+IceInternal::ShmEndpointI::secure() const
+{
+    return _instance->secure();
+}
+
+TransceiverPtr
+IceInternal::ShmEndpointI::transceiver() const
+{
+    return nullptr;
+}
+
+void
+IceInternal::ShmEndpointI::connectorsAsync(
+    function<void(vector<ConnectorPtr>)> response,
+    function<void(exception_ptr)>) const
+{
+    vector<ConnectorPtr> connectors;
+    connectors.emplace_back(make_shared<ShmConnector>(_instance, shmSocketPath(_name), _connectionId));
+    response(std::move(connectors));
+}
+
+AcceptorPtr
+IceInternal::ShmEndpointI::acceptor(const string&, const optional<SSL::ServerAuthenticationOptions>&) const
+{
+    return make_shared<ShmAcceptor>(
+        const_cast<ShmEndpointI*>(this)->shared_from_this(),
+        _instance,
+        shmSocketPath(_name));
+}
+
+vector<EndpointIPtr>
+IceInternal::ShmEndpointI::expandHost() const
+{
+    return {const_cast<ShmEndpointI*>(this)->shared_from_this()};
+}
+
+bool
+IceInternal::ShmEndpointI::isLoopbackOrMulticast() const
+{
+    // Published with the other endpoints of the object adapter: a client on another host fails to connect to it and
+    // tries the next endpoint.
+    return false;
+}
+
+shared_ptr<EndpointI>
+IceInternal::ShmEndpointI::toPublishedEndpoint(string) const
+{
+    if (_connectionId.empty())
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _name, "", _compress);
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::equivalent(const EndpointIPtr& endpoint) const
+{
+    auto shmEndpointI = dynamic_pointer_cast<ShmEndpointI>(endpoint);
+    if (!shmEndpointI)
+    {
+        return false;
+    }
+    return shmEndpointI->type() == type() && shmEndpointI->_name == _name;
+}
+
+bool
+IceInternal::ShmEndpointI::operator==(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const ShmEndpointI*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+
+    if (this == p)
+    {
+        return true;
+    }
+
+    return _name == p->_name && _connectionId == p->_connectionId && _compress == p->_compress;
+}
+
+bool
+IceInternal::ShmEndpointI::operator<(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const ShmEndpointI*>(&r);
+    if (!p)
+    {
+        const auto* e = dynamic_cast<const EndpointI*>(&r);
+        if (!e)
+        {
+            return false;
+        }
+        return type() < e->type();
+    }
+
+    if (this == p)
+    {
+        return false;
+    }
+
+    if (type() < p->type())
+    {
+        return true;
+    }
+    else if (p->type() < type())
+    {
+        return false;
+    }
+
+    if (_name < p->_name)
+    {
+        return true;
+    }
+    else if (p->_name < _name)
+    {
+        return false;
+    }
+
+    if (_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if (p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+
+    return !_compress && p->_compress;
+}
+
+size_t
+IceInternal::ShmEndpointI::hash() const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, type());
+    hashAdd(h, _name);
+    hashAdd(h, _connectionId);
+    hashAdd(h, _compress);
+    return h;
+}
+
+string
+IceInternal::ShmEndpointI::options() const
+{
+    //
+    // WARNING: Certain features, such as proxy validation in Glacier2,
+    // depend on the format of proxy strings. Changes to toString() and
+    // methods called to generate parts of the reference string could break
+    // these features. Please review for all features that depend on the
+    // format of proxyToString() before changing this and related code.
+    //
+    ostringstream s;
+    if (!_name.empty())
+    {
+        s << " -n " << _name;
+    }
+
+    if (_compress)
+    {
+        s << " -z";
+    }
+    return s.str();
+}
+
+void
+IceInternal::ShmEndpointI::initWithOptions(vector<string>& args, bool oaEndpoint)
+{
+    EndpointI::initWithOptions(args);
+
+    if (_name.empty())
+    {
+        if (oaEndpoint)
+        {
+            // Generate a name for object adapters that don't specify one.
+            const_cast<string&>(_name) = generateUUID();
+        }
+        else
+        {
+            throw ParseException(__FILE__, __LINE__, "a name must be specified using the -n option");
+        }
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::checkOption(const string& option, const string& argument, const string& endpoint)
+{
+    string arg = IceInternal::trim(argument);
+    if (option == "-n")
+    {
+        if (arg.empty())
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "no argument provided for -n option in endpoint '" + endpoint + "'");
+        }
+
+        if (!isValidName(arg))
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "invalid name '" + arg + "' provided for -n option in endpoint '" + endpoint + "'");
+        }
+        const_cast<string&>(_name) = arg;
+    }
+    else if (option == "-z")
+    {
+        if (!arg.empty())
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "unexpected argument '" + arg + "' provided for -z option in endpoint '" + endpoint + "'");
+        }
+        const_cast<bool&>(_compress) = true;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+IceInternal::ShmEndpointFactory::ShmEndpointFactory(ProtocolInstancePtr instance) : _instance(std::move(instance)) {}
+
+IceInternal::ShmEndpointFactory::~ShmEndpointFactory() = default;
+
+int16_t
+IceInternal::ShmEndpointFactory::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::ShmEndpointFactory::protocol() const
+{
+    return _instance->protocol();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::create(vector<string>& args, bool oaEndpoint) const
+{
+    auto endpt = make_shared<ShmEndpointI>(_instance);
+    endpt->initWithOptions(args, oaEndpoint);
+    return endpt;
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::read(InputStream* s) const
+{
+    return make_shared<ShmEndpointI>(_instance, s);
+}
+
+EndpointFactoryPtr
+IceInternal::ShmEndpointFactory::clone(const ProtocolInstancePtr& instance) const
+{
+    return make_shared<ShmEndpointFactory>(instance);
+}
+#endif
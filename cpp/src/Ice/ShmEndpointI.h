@@ -0,0 +1,107 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_ENDPOINT_I_H
+#define ICE_SHM_ENDPOINT_I_H
+
+#include "EndpointFactory.h"
+#include "EndpointI.h"
+#include "Ice/Endpoint.h"
+#include "ProtocolInstanceF.h"
+
+namespace IceInternal
+{
+    // The endpoint info of a shm endpoint.
+    class ShmEndpointInfo final : public Ice::EndpointInfo
+    {
+    public:
+        ShmEndpointInfo(bool compress, std::string name, std::int16_t type)
+            : EndpointInfo{compress},
+              name{std::move(name)},
+              _type{type}
+        {
+        }
+
+        ~ShmEndpointInfo() final;
+
+        [[nodiscard]] std::int16_t type() const noexcept final { return _type; }
+
+        // The name of the endpoint, which identifies the server on the local host.
+        const std::string name;
+
+    private:
+        const std::int16_t _type;
+    };
+
+    // A shared memory endpoint, for connections between processes on the same host. The endpoint is identified by a
+    // name (-n) and accepts connections on a Unix domain socket named after it in the temporary directory.
+    class ShmEndpointI final : public EndpointI, public std::enable_shared_from_this<ShmEndpointI>
+    {
+    public:
+        ShmEndpointI(ProtocolInstancePtr, std::string, std::string, bool);
+        ShmEndpointI(ProtocolInstancePtr);
+        ShmEndpointI(ProtocolInstancePtr, Ice::InputStream*);
+
+        void streamWriteImpl(Ice::OutputStream*) const final;
+
+        [[nodiscard]] Ice::EndpointInfoPtr getInfo() const noexcept final;
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] const std::string& protocol() const final;
+        [[nodiscard]] std::int32_t timeout() const final;
+        [[nodiscard]] EndpointIPtr timeout(std::int32_t) const final;
+        [[nodiscard]] const std::string& connectionId() const final;
+        [[nodiscard]] EndpointIPtr connectionId(const std::string&) const final;
+        [[nodiscard]] bool compress() const final;
+        [[nodiscard]] EndpointIPtr compress(bool) const final;
+        [[nodiscard]] bool datagram() const final;
+        [[nodiscard]] bool secure() const final;
+
+        [[nodiscard]] TransceiverPtr transceiver() const final;
+        void connectorsAsync(
+            std::function<void(std::vector<ConnectorPtr>)>,
+            std::function<void(std::exception_ptr)>) const final;
+        [[nodiscard]] AcceptorPtr
+        acceptor(const std::string&, const std::optional<Ice::SSL::ServerAuthenticationOptions>&) const final;
+        [[nodiscard]] std::vector<EndpointIPtr> expandHost() const final;
+        [[nodiscard]] bool isLoopbackOrMulticast() const final;
+        [[nodiscard]] std::shared_ptr<EndpointI> toPublishedEndpoint(std::string publishedHost) const final;
+        [[nodiscard]] bool equivalent(const EndpointIPtr&) const final;
+
+        bool operator==(const Ice::Endpoint&) const final;
+        bool operator<(const Ice::Endpoint&) const final;
+
+        [[nodiscard]] std::size_t hash() const noexcept final;
+        [[nodiscard]] std::string options() const final;
+
+        void initWithOptions(std::vector<std::string>&, bool);
+
+    private:
+        bool checkOption(const std::string&, const std::string&, const std::string&) final;
+
+        //
+        // All members are const, because endpoints are immutable.
+        //
+        const ProtocolInstancePtr _instance;
+        const std::string _name;
+        const std::string _connectionId;
+        const bool _compress;
+    };
+
+    class ShmEndpointFactory final : public EndpointFactory
+    {
+    public:
+        ShmEndpointFactory(ProtocolInstancePtr);
+        ~ShmEndpointFactory() override;
+
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] std::string protocol() const final;
+        EndpointIPtr create(std::vector<std::string>&, bool) const final;
+        EndpointIPtr read(Ice::InputStream*) const final;
+
+        [[nodiscard]] EndpointFactoryPtr clone(const ProtocolInstancePtr&) const final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+    };
+}
+
+#endif
@@ -0,0 +1,613 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmTransceiver.h"
+#    include "Ice/Buffer.h"
+#    include "Ice/LocalExceptions.h"
+#    include "ProtocolInstance.h"
+
+#    include <algorithm>
+#    include <cstdlib>
+#    include <cstring>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#    include <sys/stat.h>
+#    include <sys/un.h>
+#    include <unistd.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The size of each ring buffer.
+    const size_t ringCapacity = 1024 * 1024;
+
+    // The largest ring capacity a server accepts from a client.
+    const size_t maxRingCapacity = 64 * 1024 * 1024;
+
+    const array<char, 4> helloMagic = {'I', 'c', 'e', 'M'};
+    const char* const segmentPrefix = "/ice-shm-";
+
+    // Set in a token to announce inline bytes, that is bytes sent over the socket.
+    const uint32_t inlineFlag = 0x80000000;
+
+    // The most bytes announced by a single token.
+    const size_t maxChunk = 0x40000000;
+
+    // The header of a ring. The tail is on its own cache line to avoid false sharing with the other ring.
+    struct alignas(64) RingHeader
+    {
+        atomic<uint64_t> tail;
+    };
+
+    static_assert(atomic<uint64_t>::is_always_lock_free, "shm rings require lock-free 64-bit atomics");
+
+    atomic<unsigned int> segmentCounter{0};
+}
+
+string
+IceInternal::shmSocketDirectory()
+{
+    const char* tmpdir = getenv("TMPDIR");
+    string path = tmpdir && *tmpdir ? tmpdir : "/tmp";
+    if (path.back() != '/')
+    {
+        path += '/';
+    }
+    return path + "ice-shm-" + to_string(geteuid());
+}
+
+string
+IceInternal::shmSocketPath(const string& name)
+{
+    return shmSocketDirectory() + "/" + name;
+}
+
+IceInternal::ShmConnectionInfo::~ShmConnectionInfo() = default;
+
+NativeInfoPtr
+IceInternal::ShmTransceiver::getNativeInfo()
+{
+    return shared_from_this();
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::initialize(Buffer&, Buffer&)
+{
+    while (_state != StateConnected)
+    {
+        switch (_state)
+        {
+            case StateSendHello:
+            {
+                ssize_t ret = send(_hello.data() + _helloPos, _hello.size() - _helloPos);
+                if (ret < 0)
+                {
+                    return SocketOperationWrite;
+                }
+                _helloPos += static_cast<size_t>(ret);
+                if (_helloPos == _hello.size())
+                {
+                    _state = StateReceiveAck;
+                }
+                break;
+            }
+            case StateReceiveAck:
+            {
+                char ack;
+                if (receive(&ack, 1) < 0)
+                {
+                    return SocketOperationRead;
+                }
+
+                // The server has mapped and unlinked the segment.
+                _segmentLinked = false;
+                _state = StateConnected;
+                break;
+            }
+            case StateReceiveHello:
+            {
+                ssize_t ret = receive(_hello.data() + _helloPos, _hello.size() - _helloPos);
+                if (ret < 0)
+                {
+                    return SocketOperationRead;
+                }
+                _helloPos += static_cast<size_t>(ret);
+                if (_helloPos == _hello.size())
+                {
+                    openSegment();
+                    _state = StateSendAck;
+                }
+                break;
+            }
+            case StateSendAck:
+            {
+                char ack = 1;
+                if (send(&ack, 1) < 0)
+                {
+                    return SocketOperationWrite;
+                }
+                _state = StateConnected;
+                break;
+            }
+            case StateConnected:
+            {
+                break;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::closing(bool initiator, exception_ptr)
+{
+    // If we are initiating the connection closure, wait for the peer to close the connection. Otherwise, close
+    // immediately.
+    return initiator ? SocketOperationRead : SocketOperationNone;
+}
+
+void
+IceInternal::ShmTransceiver::close()
+{
+    if (_fd != INVALID_SOCKET)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+    }
+
+    if (_segmentLinked)
+    {
+        // The server never opened the segment.
+        shm_unlink(_segmentName.c_str());
+        _segmentLinked = false;
+    }
+
+    if (_segment)
+    {
+        munmap(_segment, _segmentSize);
+        _segment = nullptr;
+    }
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::write(Buffer& buf)
+{
+    while (buf.i != buf.b.end() || _tokenOutPos < _tokenOut.size())
+    {
+        if (_tokenOutPos < _tokenOut.size())
+        {
+            ssize_t ret = send(_tokenOut.data() + _tokenOutPos, _tokenOut.size() - _tokenOutPos);
+            if (ret < 0)
+            {
+                return SocketOperationWrite;
+            }
+            _tokenOutPos += static_cast<size_t>(ret);
+            continue;
+        }
+
+        auto available = static_cast<size_t>(buf.b.end() - buf.i);
+        if (_inlineOut > 0)
+        {
+            ssize_t ret = send(buf.i, min(available, _inlineOut));
+            if (ret < 0)
+            {
+                return SocketOperationWrite;
+            }
+            buf.i += ret;
+            _inlineOut -= static_cast<size_t>(ret);
+            continue;
+        }
+
+        // The tail is written by the peer: never trust it to stay within the ring.
+        uint64_t used = _outHead - _outTail->load(memory_order_acquire);
+        if (used > _capacity)
+        {
+            throw ProtocolException{__FILE__, __LINE__, "invalid shm ring tail"};
+        }
+
+        uint32_t token;
+        auto space = static_cast<size_t>(_capacity - used);
+        if (space > 0)
+        {
+            auto length = min(available, space);
+            copyToRing(buf.i, length);
+            buf.i += length;
+            token = static_cast<uint32_t>(length);
+        }
+        else
+        {
+            // The ring is full, send the next chunk over the socket: the socket buffers it, or makes us wait for the
+            // peer to catch up.
+            _inlineOut = min(available, maxChunk);
+            token = static_cast<uint32_t>(_inlineOut) | inlineFlag;
+        }
+        memcpy(_tokenOut.data(), &token, sizeof(token));
+        _tokenOutPos = 0;
+    }
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::read(Buffer& buf)
+{
+    while (buf.i != buf.b.end())
+    {
+        auto wanted = static_cast<size_t>(buf.b.end() - buf.i);
+        if (_ringIn > 0)
+        {
+            auto length = min(wanted, _ringIn);
+            copyFromRing(buf.i, length);
+            buf.i += length;
+            _ringIn -= length;
+            continue;
+        }
+
+        if (_inlineIn > 0)
+        {
+            ssize_t ret = receive(buf.i, min(wanted, _inlineIn));
+            if (ret < 0)
+            {
+                ready(SocketOperationRead, false);
+                return SocketOperationRead;
+            }
+            buf.i += ret;
+            _inlineIn -= static_cast<size_t>(ret);
+            continue;
+        }
+
+        ssize_t ret = receive(_tokenIn.data() + _tokenInPos, _tokenIn.size() - _tokenInPos);
+        if (ret < 0)
+        {
+            ready(SocketOperationRead, false);
+            return SocketOperationRead;
+        }
+        _tokenInPos += static_cast<size_t>(ret);
+        if (_tokenInPos == _tokenIn.size())
+        {
+            _tokenInPos = 0;
+            uint32_t token;
+            memcpy(&token, _tokenIn.data(), sizeof(token));
+            auto length = static_cast<size_t>(token & ~inlineFlag);
+            if (length == 0 || length > maxChunk || (!(token & inlineFlag) && length > _capacity))
+            {
+                throw ProtocolException{__FILE__, __LINE__, "received invalid shm token"};
+            }
+
+            if (token & inlineFlag)
+            {
+                _inlineIn = length;
+            }
+            else
+            {
+                _ringIn = length;
+            }
+        }
+    }
+
+    // The socket doesn't signal the bytes left in the ring, so we signal them ourselves.
+    ready(SocketOperationRead, _ringIn > 0);
+    return SocketOperationNone;
+}
+
+string
+IceInternal::ShmTransceiver::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::ShmTransceiver::toString() const
+{
+    return "socket = " + _path + "\nsegment = " + _segmentName;
+}
+
+string
+IceInternal::ShmTransceiver::toDetailedString() const
+{
+    return toString();
+}
+
+ConnectionInfoPtr
+IceInternal::ShmTransceiver::getInfo(bool incoming, string adapterName, string connectionId) const
+{
+    return make_shared<ShmConnectionInfo>(incoming, std::move(adapterName), std::move(connectionId), _segmentName);
+}
+
+void
+IceInternal::ShmTransceiver::checkSendSize(const Buffer&)
+{
+}
+
+void
+IceInternal::ShmTransceiver::setBufferSize(int, int)
+{
+    // The ring size is fixed when the connection is established.
+}
+
+IceInternal::ShmTransceiver::ShmTransceiver(ProtocolInstancePtr instance, const string& path)
+    : NativeInfo(::socket(AF_UNIX, SOCK_STREAM, 0)),
+      _instance(std::move(instance)),
+      _incoming(false),
+      _path(path),
+      _state(StateSendHello),
+      _tokenOutPos(_tokenOut.size())
+{
+    if (_fd == INVALID_SOCKET)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    setBlock(_fd, false);
+
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    if (_path.size() >= sizeof(addr.sun_path))
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+        throw ConnectFailedException(__FILE__, __LINE__, ENAMETOOLONG, _path);
+    }
+    memcpy(addr.sun_path, _path.c_str(), _path.size() + 1);
+
+    // Connecting a Unix domain socket doesn't block: the connection is either accepted by the kernel or refused.
+    while (::connect(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR)
+    {
+        if (interrupted())
+        {
+            continue;
+        }
+
+        int error = getSocketErrno();
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+        if (error == ENOENT || error == ECONNREFUSED)
+        {
+            throw ConnectionRefusedException{__FILE__, __LINE__, _path};
+        }
+        throw ConnectFailedException(__FILE__, __LINE__, error, _path);
+    }
+
+    try
+    {
+        createSegment();
+    }
+    catch (...)
+    {
+        close();
+        throw;
+    }
+}
+
+IceInternal::ShmTransceiver::ShmTransceiver(ProtocolInstancePtr instance, SOCKET fd, const string& path)
+    : NativeInfo(fd),
+      _instance(std::move(instance)),
+      _incoming(true),
+      _path(path),
+      _state(StateReceiveHello),
+      _tokenOutPos(_tokenOut.size())
+{
+}
+
+IceInternal::ShmTransceiver::~ShmTransceiver()
+{
+    assert(_fd == INVALID_SOCKET);
+    assert(!_segment);
+}
+
+void
+IceInternal::ShmTransceiver::createSegment()
+{
+    int fd = -1;
+    for (int attempt = 0; fd < 0; ++attempt)
+    {
+        _segmentName = segmentPrefix + to_string(getpid()) + "-" + to_string(segmentCounter++);
+        fd = shm_open(_segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (fd < 0 && (errno != EEXIST || attempt == 16))
+        {
+            throw SyscallException{__FILE__, __LINE__, "cannot create shared memory segment", errno};
+        }
+    }
+    _segmentLinked = true;
+
+    size_t size = 2 * (sizeof(RingHeader) + ringCapacity);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        int error = errno;
+        ::close(fd);
+        throw SyscallException{__FILE__, __LINE__, "cannot size shared memory segment", error};
+    }
+    _capacity = ringCapacity;
+    mapSegment(fd, size);
+
+    // hello = magic, ring capacity, segment name
+    _hello.fill(0);
+    memcpy(_hello.data(), helloMagic.data(), helloMagic.size());
+    auto capacity = static_cast<uint32_t>(_capacity);
+    memcpy(_hello.data() + 4, &capacity, sizeof(capacity));
+    assert(_segmentName.size() < _hello.size() - 8);
+    memcpy(_hello.data() + 8, _segmentName.c_str(), _segmentName.size());
+}
+
+void
+IceInternal::ShmTransceiver::openSegment()
+{
+    if (!equal(helloMagic.begin(), helloMagic.end(), _hello.begin()))
+    {
+        throw ProtocolException{__FILE__, __LINE__, "received invalid shm handshake"};
+    }
+
+    uint32_t capacity;
+    memcpy(&capacity, _hello.data() + 4, sizeof(capacity));
+    _hello.back() = '\0';
+    _segmentName = _hello.data() + 8;
+
+    // Only open segments created by the Ice shm transport: we unlink the segment once mapped.
+    if (capacity == 0 || capacity > maxRingCapacity ||
+        _segmentName.compare(0, strlen(segmentPrefix), segmentPrefix) != 0 || _segmentName.find('/', 1) != string::npos)
+    {
+        throw ProtocolException{__FILE__, __LINE__, "received invalid shm handshake"};
+    }
+
+    // The segment must belong to the peer: otherwise a client could make us map and unlink the segment of another
+    // connection.
+    uid_t peerUid;
+#    ifdef __linux__
+    ucred credentials;
+    socklen_t credentialsLength = sizeof(credentials);
+    if (getsockopt(_fd, SOL_SOCKET, SO_PEERCRED, &credentials, &credentialsLength) != 0)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    peerUid = credentials.uid;
+#    else
+    gid_t peerGid;
+    if (getpeereid(_fd, &peerUid, &peerGid) != 0)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+#    endif
+
+    int fd = shm_open(_segmentName.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        throw SyscallException{__FILE__, __LINE__, "cannot open shared memory segment", errno};
+    }
+
+    size_t size = 2 * (sizeof(RingHeader) + capacity);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_uid != peerUid || (st.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+    {
+        ::close(fd);
+        throw ProtocolException{
+            __FILE__,
+            __LINE__,
+            "shared memory segment '" + _segmentName + "' is not owned by the peer"};
+    }
+    if (st.st_size != static_cast<off_t>(size))
+    {
+        ::close(fd);
+        throw ProtocolException{__FILE__, __LINE__, "shared memory segment '" + _segmentName + "' has an invalid size"};
+    }
+    shm_unlink(_segmentName.c_str());
+    _capacity = capacity;
+    mapSegment(fd, size);
+}
+
+void
+IceInternal::ShmTransceiver::mapSegment(int fd, size_t size)
+{
+    void* segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    ::close(fd);
+    if (segment == MAP_FAILED)
+    {
+        throw SyscallException{__FILE__, __LINE__, "cannot map shared memory segment", error};
+    }
+    _segment = segment;
+    _segmentSize = size;
+
+    // Layout: the header of the client-to-server ring, the header of the server-to-client ring, then their data.
+    auto* headers = static_cast<RingHeader*>(segment);
+    auto* data = reinterpret_cast<byte*>(headers + 2);
+    RingHeader& clientToServer = headers[0];
+    RingHeader& serverToClient = headers[1];
+    _outTail = _incoming ? &serverToClient.tail : &clientToServer.tail;
+    _inTail = _incoming ? &clientToServer.tail : &serverToClient.tail;
+    _outData = _incoming ? data + _capacity : data;
+    _inData = _incoming ? data : data + _capacity;
+}
+
+ssize_t
+IceInternal::ShmTransceiver::send(const void* buf, size_t length)
+{
+    assert(_fd != INVALID_SOCKET);
+    while (true)
+    {
+        ssize_t ret = ::send(_fd, buf, length, 0);
+        if (ret >= 0)
+        {
+            return ret;
+        }
+
+        if (interrupted())
+        {
+            continue;
+        }
+
+        if (wouldBlock())
+        {
+            return -1;
+        }
+
+        if (connectionLost())
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno(), _path);
+        }
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+}
+
+ssize_t
+IceInternal::ShmTransceiver::receive(void* buf, size_t length)
+{
+    assert(_fd != INVALID_SOCKET);
+    while (true)
+    {
+        ssize_t ret = ::recv(_fd, buf, length, 0);
+        if (ret == 0)
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, _path);
+        }
+        else if (ret > 0)
+        {
+            return ret;
+        }
+
+        if (interrupted())
+        {
+            continue;
+        }
+
+        if (wouldBlock())
+        {
+            return -1;
+        }
+
+        if (connectionLost())
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno(), _path);
+        }
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+}
+
+void
+IceInternal::ShmTransceiver::copyToRing(const byte* buf, size_t length)
+{
+    assert(length <= _capacity);
+    auto offset = static_cast<size_t>(_outHead % _capacity);
+    auto first = min(length, _capacity - offset);
+    memcpy(_outData + offset, buf, first);
+    memcpy(_outData, buf + first, length - first);
+    _outHead += length;
+}
+
+void
+IceInternal::ShmTransceiver::copyFromRing(byte* buf, size_t length)
+{
+    auto offset = static_cast<size_t>(_inHead % _capacity);
+    auto first = min(length, _capacity - offset);
+    memcpy(buf, _inData + offset, first);
+    memcpy(buf + first, _inData, length - first);
+    _inHead += length;
+
+    // Give the space back to the writer.
+    _inTail->store(_inHead, memory_order_release);
+}
+#endif
@@ -0,0 +1,128 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_TRANSCEIVER_H
+#define ICE_SHM_TRANSCEIVER_H
+
+#include "Ice/Connection.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "Transceiver.h"
+
+#include <array>
+#include <atomic>
+
+namespace IceInternal
+{
+    // Returns the directory of the Unix domain sockets of the shm endpoints. Each user has its own directory.
+    std::string shmSocketDirectory();
+
+    // Returns the path of the Unix domain socket of the shm endpoint with the given name.
+    std::string shmSocketPath(const std::string&);
+
+    // The connection info of a shm connection.
+    class ShmConnectionInfo final : public Ice::ConnectionInfo
+    {
+    public:
+        ShmConnectionInfo(bool incoming, std::string adapterName, std::string connectionId, std::string name)
+            : ConnectionInfo{incoming, std::move(adapterName), std::move(connectionId)},
+              name{std::move(name)}
+        {
+        }
+
+        ~ShmConnectionInfo() final;
+
+        // The name of the shared memory segment used by the connection.
+        const std::string name;
+    };
+
+    // A shm connection exchanges its data through two single-producer single-consumer ring buffers, one per
+    // direction, in a shared memory segment created by the client. The connection's Unix domain socket carries the
+    // handshake and 4-byte tokens that tell the peer how many bytes are available in the ring. When the ring is full,
+    // a token announces bytes sent inline over the socket instead, so a slow reader pushes back on the writer through
+    // the socket without the writer having to poll the ring.
+    class ShmTransceiver final : public Transceiver,
+                                 public NativeInfo,
+                                 public std::enable_shared_from_this<ShmTransceiver>
+    {
+    public:
+        // Creates the client side of a connection to the given socket path.
+        ShmTransceiver(ProtocolInstancePtr, const std::string&);
+
+        // Creates the server side of a connection accepted on the given socket.
+        ShmTransceiver(ProtocolInstancePtr, SOCKET, const std::string&);
+
+        ~ShmTransceiver() override;
+
+        NativeInfoPtr getNativeInfo() final;
+
+        SocketOperation initialize(Buffer&, Buffer&) final;
+        SocketOperation closing(bool, std::exception_ptr) final;
+
+        void close() final;
+        SocketOperation write(Buffer&) final;
+        SocketOperation read(Buffer&) final;
+
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+        [[nodiscard]] Ice::ConnectionInfoPtr
+        getInfo(bool incoming, std::string adapterName, std::string connectionId) const final;
+        void checkSendSize(const Buffer&) final;
+        void setBufferSize(int rcvSize, int sndSize) final;
+
+    private:
+        enum State
+        {
+            StateSendHello,
+            StateReceiveHello,
+            StateSendAck,
+            StateReceiveAck,
+            StateConnected
+        };
+
+        void createSegment();
+        void openSegment();
+        void mapSegment(int, std::size_t);
+
+        ssize_t send(const void*, std::size_t);
+        ssize_t receive(void*, std::size_t);
+
+        void copyToRing(const std::byte*, std::size_t);
+        void copyFromRing(std::byte*, std::size_t);
+
+        const ProtocolInstancePtr _instance;
+        const bool _incoming;
+        const std::string _path;
+        State _state;
+
+        std::string _segmentName;
+        bool _segmentLinked{false};
+        void* _segment{nullptr};
+        std::size_t _segmentSize{0};
+        std::size_t _capacity{0};
+
+        // The ring this side writes to (_out) and reads from (_in). The tail of a ring is published by its reader.
+        std::atomic<std::uint64_t>* _outTail{nullptr};
+        std::byte* _outData{nullptr};
+        std::uint64_t _outHead{0};
+        std::atomic<std::uint64_t>* _inTail{nullptr};
+        std::byte* _inData{nullptr};
+        std::uint64_t _inHead{0};
+
+        std::array<char, 64> _hello;
+        std::size_t _helloPos{0};
+
+        // The token being sent and the number of inline bytes it announced that remain to be sent.
+        std::array<std::byte, 4> _tokenOut;
+        std::size_t _tokenOutPos;
+        std::size_t _inlineOut{0};
+
+        // The token being received and the number of bytes it announced that remain to be read.
+        std::array<std::byte, 4> _tokenIn;
+        std::size_t _tokenInPos{0};
+        std::size_t _ringIn{0};
+        std::size_t _inlineIn{0};
+    };
+}
+
+#endif
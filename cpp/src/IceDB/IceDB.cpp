@@ -3,6 +3,7 @@
 #include "IceDB.h"
 #include "Ice/Initialize.h"
 
+#include <algorithm>
 #include <lmdb.h>
 #include <sstream>
 
@@ -198,6 +199,56 @@ ReadWriteTxn::~ReadWriteTxn() = default;
 
 ReadWriteTxn::ReadWriteTxn(const Env& env) : Txn(env, 0) {}
 
+GroupCommit::GroupCommit(const Env& env) : _env(env)
+{
+    const int rc = mdb_env_set_flags(_env.menv(), MDB_NOSYNC, 1);
+    if (rc != MDB_SUCCESS)
+    {
+        throw LMDBException(__FILE__, __LINE__, rc);
+    }
+}
+
+uint64_t
+GroupCommit::commit(ReadWriteTxn& txn)
+{
+    txn.commit();
+    lock_guard lock(_mutex);
+    return ++_committed;
+}
+
+void
+GroupCommit::sync(uint64_t commit)
+{
+    unique_lock lock(_mutex);
+    while (_synced < commit)
+    {
+        if (_syncing)
+        {
+            _condVar.wait(lock);
+            continue;
+        }
+
+        // Flush the transactions committed so far. The transactions committed during this flush are flushed by the
+        // next one.
+        _syncing = true;
+        const uint64_t committed = _committed;
+        lock.unlock();
+        const int rc = mdb_env_sync(_env.menv(), 1);
+        lock.lock();
+        _syncing = false;
+        if (rc == MDB_SUCCESS)
+        {
+            _synced = max(_synced, committed);
+        }
+        _condVar.notify_all();
+
+        if (rc != MDB_SUCCESS)
+        {
+            throw LMDBException(__FILE__, __LINE__, rc);
+        }
+    }
+}
+
 DbiBase::DbiBase(const Txn& txn, const std::string& name, unsigned int flags, MDB_cmp_func* cmp)
 {
     int rc = mdb_dbi_open(txn.mtxn(), name.c_str(), flags, &_mdbi);
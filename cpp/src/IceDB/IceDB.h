@@ -9,7 +9,9 @@
 #include "Ice/LocalException.h"
 #include "Ice/OutputStream.h"
 
+#include <condition_variable>
 #include <lmdb.h>
+#include <mutex>
 
 namespace IceDB
 {
@@ -125,6 +127,31 @@ namespace IceDB
         ~ReadWriteTxn();
     };
 
+    //
+    // GroupCommit sets MDB_NOSYNC on the environment and flushes the committed transactions to disk with
+    // mdb_env_sync. A single flush makes durable the transactions of all the writers waiting for it: while a
+    // flush is in progress, the transactions committed concurrently are flushed together by the next one.
+    //
+    class GroupCommit
+    {
+    public:
+        explicit GroupCommit(const Env&);
+
+        // Commits the transaction without flushing it to disk, and returns its commit number.
+        std::uint64_t commit(ReadWriteTxn&);
+
+        // Waits for the transaction with the given commit number to be flushed to disk.
+        void sync(std::uint64_t);
+
+    private:
+        const Env& _env;
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        std::uint64_t _committed{0};
+        std::uint64_t _synced{0};
+        bool _syncing{false};
+    };
+
     class DbiBase
     {
     public:
@@ -315,6 +342,24 @@ namespace IceDB
             return false;
         }
 
+        // Positions the cursor on the first key greater than or equal to key, and returns this key and its data.
+        bool findRange(K& key, D& data)
+        {
+            unsigned char kbuf[maxKeySize];
+            MDB_val mkey = {maxKeySize, kbuf};
+            if (Codec<K, C, H>::write(key, mkey))
+            {
+                MDB_val mdata;
+                if (CursorBase::get(&mkey, &mdata, MDB_SET_RANGE))
+                {
+                    Codec<K, C, H>::read(key, mkey, _marshalingContext);
+                    Codec<D, C, H>::read(data, mdata, _marshalingContext);
+                    return true;
+                }
+            }
+            return false;
+        }
+
     protected:
         C _marshalingContext;
     };
@@ -10,6 +10,7 @@
 #include "TraceLevels.h"
 #include "Util.h"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 #include <thread>
@@ -39,6 +40,13 @@
 #    include <grp.h> // for setgroups
 #endif
 
+// posix_spawn_file_actions_addchdir_np and posix_spawn_file_actions_addclosefrom_np are required to set up the server
+// process like the fork child does.
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+#    define ICEGRID_HAS_POSIX_SPAWN
+#    include <spawn.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceGrid;
@@ -154,6 +162,111 @@ namespace IceGrid
 
 #endif
 
+#ifdef ICEGRID_HAS_POSIX_SPAWN
+    //
+    // Spawn the server process with posix_spawnp. Unlike fork, posix_spawn doesn't copy the page tables of the node
+    // (glibc uses a vfork-like clone), which keeps the activation cheap with a large node process. The spawned
+    // process keeps the given pipe descriptor open as descriptor 3, so the node detects the server termination.
+    // Returns 0 on success or the error number otherwise.
+    //
+    int spawnServer(pid_t& pid, const StringSeq& args, const StringSeq& envs, const string& pwd, int pipeFd)
+    {
+        //
+        // The server environment is the node environment with the server environment variables added.
+        //
+        StringSeq environment;
+        for (char** e = environ; *e != nullptr; ++e)
+        {
+            environment.emplace_back(*e);
+        }
+        for (const auto& env : envs)
+        {
+            const size_t pos = env.find('=');
+            const string prefix = env.substr(0, pos) + "=";
+            auto p = find_if(
+                environment.begin(),
+                environment.end(),
+                [&prefix](const string& value) { return value.compare(0, prefix.size(), prefix) == 0; });
+            if (pos == string::npos)
+            {
+                // Like putenv with the fork child, a variable without '=' is removed from the environment.
+                if (p != environment.end())
+                {
+                    environment.erase(p);
+                }
+            }
+            else if (p != environment.end())
+            {
+                *p = env;
+            }
+            else
+            {
+                environment.push_back(env);
+            }
+        }
+
+        IceInternal::ArgVector av(args);
+        IceInternal::ArgVector ev(environment);
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, pipeFd, 3);
+        posix_spawn_file_actions_addclosefrom_np(&actions, 4);
+        if (!pwd.empty())
+        {
+            posix_spawn_file_actions_addchdir_np(&actions, pwd.c_str());
+        }
+
+        //
+        // Assign a new process group and unblock the signals blocked by Ice::CtrlCHandler.
+        //
+        posix_spawnattr_t attr;
+        posix_spawnattr_init(&attr);
+        sigset_t sigs;
+        pthread_sigmask(SIG_SETMASK, nullptr, &sigs);
+        sigdelset(&sigs, SIGHUP);
+        sigdelset(&sigs, SIGINT);
+        sigdelset(&sigs, SIGTERM);
+        posix_spawnattr_setsigmask(&attr, &sigs);
+        posix_spawnattr_setpgroup(&attr, 0);
+        posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK);
+
+        int error = posix_spawnp(&pid, av.argv[0], &actions, &attr, av.argv, ev.argv);
+
+        posix_spawnattr_destroy(&attr);
+        posix_spawn_file_actions_destroy(&actions);
+        return error;
+    }
+
+    //
+    // Returns 0 if the server can change its working directory to pwd, or the error number otherwise. posix_spawn
+    // reports the failure of the chdir file action like a failure to execute the server.
+    //
+    int checkWorkingDirectory(const string& pwd)
+    {
+        struct stat buf;
+        if (stat(pwd.c_str(), &buf) == -1)
+        {
+            return errno;
+        }
+        else if (!S_ISDIR(buf.st_mode))
+        {
+            return ENOTDIR;
+        }
+        return access(pwd.c_str(), X_OK) == -1 ? errno : 0;
+    }
+
+    //
+    // Returns true if the server environment variables set PATH: execvp looks up the executable with the server
+    // PATH, whereas posix_spawnp uses the node PATH.
+    //
+    bool setsPath(const StringSeq& envs)
+    {
+        return find_if(envs.begin(), envs.end(), [](const string& env) { return env.compare(0, 5, "PATH=") == 0; }) !=
+               envs.end();
+    }
+#endif
+
     string signalToString(int signal)
     {
         switch (signal)
@@ -350,7 +463,9 @@ activatorWaitCallback(PVOID data, BOOLEAN)
 }
 #endif
 
-Activator::Activator(const shared_ptr<TraceLevels>& traceLevels) : _traceLevels(traceLevels)
+Activator::Activator(const shared_ptr<TraceLevels>& traceLevels, int concurrentActivations)
+    : _traceLevels(traceLevels),
+      _concurrentActivations(concurrentActivations > 0 ? concurrentActivations : INT_MAX) // 0 means no limit
 {
 #ifdef _WIN32
     _hIntr = CreateEvent(
@@ -404,13 +519,36 @@ Activator::activate(
     const Ice::StringSeq& envs,
     const shared_ptr<ServerI>& server)
 {
-    lock_guard lock(_mutex);
+    unique_lock lock(_mutex);
 
     if (_deactivating)
     {
         throw runtime_error("The node is being shutdown.");
     }
 
+    //
+    // The server processes are created without holding the mutex. Keep track of the processes being created until
+    // they are registered or the activation failed, shutdown and the termination listener wait for them.
+    //
+    struct ActivationSlot
+    {
+        Activator& activator;
+        unique_lock<mutex>& lock;
+
+        ~ActivationSlot()
+        {
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+            }
+            --activator._activating;
+            activator._condVar.notify_all();
+            activator.setInterrupt(); // The termination listener might be waiting for the activation to complete.
+        }
+    };
+    ++_activating;
+    ActivationSlot slot{*this, lock};
+
     string path{exePath}; // NOLINT(performance-unnecessary-copy-initialization)
     if (path.empty())
     {
@@ -701,6 +839,49 @@ Activator::activate(
 
     return static_cast<int32_t>(process.pid);
 #else
+    lock.unlock();
+
+#    ifdef ICEGRID_HAS_POSIX_SPAWN
+    //
+    // Use posix_spawn unless the server runs with another user or group than the node: posix_spawn can't change the
+    // process credentials. It can't reset the supplementary groups either, which the fork child does when the node
+    // runs as root.
+    //
+    if (getuid() != 0 && uid == getuid() && gid == getgid() && !setsPath(envs))
+    {
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+            throw SyscallException{__FILE__, __LINE__, "pipe failed", errno};
+        }
+
+        pid_t pid;
+        int error = spawnServer(pid, args, envs, pwd, fds[1]);
+        close(fds[1]);
+        if (error != 0)
+        {
+            close(fds[0]);
+            string message;
+            const int pwdError = pwd.empty() ? 0 : checkWorkingDirectory(pwd);
+            if (pwdError != 0)
+            {
+                message = "cannot change working directory to '" + pwd + "': " + IceInternal::errorToString(pwdError);
+            }
+            else
+            {
+                message = "cannot execute '" + path + "': " + IceInternal::errorToString(error);
+            }
+            Ice::Warning out(_traceLevels->logger);
+            out << "server activation failed for '" << name << "':\n" << message;
+            throw runtime_error(message);
+        }
+
+        lock.lock();
+        addProcess(name, pid, fds[0], server);
+        return pid;
+    }
+#    endif
+
     struct passwd pwbuf;
     vector<char> buffer(4096); // 4KB initial buffer size
     struct passwd* pw;
@@ -935,8 +1116,7 @@ Activator::activate(
         ssize_t rs;
         string message;
 
-        // We keep the Activator mutex locked for the whole activate.
-        while ((rs = read(errorFds[0], s, sizeof(s))) > 0) // NOLINT(clang-analyzer-unix.BlockInCriticalSection)
+        while ((rs = read(errorFds[0], s, sizeof(s))) > 0)
         {
             message.append(s, static_cast<size_t>(rs));
         }
@@ -961,17 +1141,8 @@ Activator::activate(
         //
         close(errorFds[0]);
 
-        Process process;
-        process.pid = pid;
-        process.pipeFd = fds[0];
-        process.server = server;
-        _processes.insert(make_pair(name, process));
-
-        int flags = fcntl(process.pipeFd, F_GETFL);
-        flags |= O_NONBLOCK;
-        fcntl(process.pipeFd, F_SETFL, flags);
-
-        setInterrupt();
+        lock.lock();
+        addProcess(name, pid, fds[0], server);
 
         //
         // Don't print the following trace, this might interfere with the
@@ -988,6 +1159,67 @@ Activator::activate(
 #endif
 }
 
+bool
+Activator::reserveActivation(const shared_ptr<ServerI>& server)
+{
+    lock_guard lock(_mutex);
+
+    //
+    // A server holds its activation slot until it's active or its activation failed. Once the node is being shutdown,
+    // the activation doesn't wait for a slot, Activator::activate rejects it.
+    //
+    if (_deactivating || _activations.find(server->getId()) != _activations.end())
+    {
+        return true;
+    }
+    else if (static_cast<int>(_activations.size()) < _concurrentActivations)
+    {
+        _activations.insert(server->getId());
+        return true;
+    }
+
+    if (find(_pendingActivations.begin(), _pendingActivations.end(), server) == _pendingActivations.end())
+    {
+        _pendingActivations.push_back(server);
+    }
+    return false;
+}
+
+vector<shared_ptr<ServerI>>
+Activator::releaseActivation(const string& name)
+{
+    lock_guard lock(_mutex);
+
+    //
+    // A server which is no longer activating doesn't need an activation slot anymore.
+    //
+    _pendingActivations.erase(
+        remove_if(
+            _pendingActivations.begin(),
+            _pendingActivations.end(),
+            [&name](const shared_ptr<ServerI>& server) { return server->getId() == name; }),
+        _pendingActivations.end());
+
+    //
+    // Hand over the released slot to the servers waiting for one. These servers must resume their activation.
+    //
+    vector<shared_ptr<ServerI>> servers;
+    if (_activations.erase(name) > 0)
+    {
+        while (!_pendingActivations.empty() &&
+               (_deactivating || static_cast<int>(_activations.size()) < _concurrentActivations))
+        {
+            if (!_deactivating)
+            {
+                _activations.insert(_pendingActivations.front()->getId());
+            }
+            servers.push_back(_pendingActivations.front());
+            _pendingActivations.pop_front();
+        }
+    }
+    return servers;
+}
+
 void
 Activator::deactivate(const string& name, const optional<Ice::ProcessPrx>& process)
 {
@@ -1186,9 +1418,13 @@ Activator::destroy()
 {
     map<string, Process> processes;
     {
-        lock_guard lock(_mutex);
+        unique_lock lock(_mutex);
         assert(_deactivating);
+
+        // Wait for the processes being created to be registered, to stop them as well.
+        _condVar.wait(lock, [this] { return _activating == 0; });
         processes = _processes;
+        _pendingActivations.clear();
     }
 
     //
@@ -1300,7 +1536,7 @@ Activator::terminationListener()
                 }
             }
             _terminated.clear();
-            deactivated = _deactivating && _processes.empty();
+            deactivated = _deactivating && _processes.empty() && _activating == 0;
         }
 
         for (vector<Process>::const_iterator p = terminated.begin(); p != terminated.end(); ++p)
@@ -1392,7 +1628,7 @@ Activator::terminationListener()
             {
                 clearInterrupt();
 
-                if (_deactivating && _processes.empty())
+                if (_deactivating && _processes.empty() && _activating == 0)
                 {
                     return;
                 }
@@ -1467,7 +1703,7 @@ Activator::terminationListener()
             //
             // We are deactivating and there's no more active processes.
             //
-            deactivated = _deactivating && _processes.empty();
+            deactivated = _deactivating && _processes.empty() && _activating == 0;
         }
 
         for (const auto& p : terminated)
@@ -1543,6 +1779,23 @@ Activator::setInterrupt()
 }
 
 #ifndef _WIN32
+void
+Activator::addProcess(const string& name, pid_t pid, int pipeFd, const shared_ptr<ServerI>& server)
+{
+    // Must be called with _mutex locked.
+    Process process;
+    process.pid = pid;
+    process.pipeFd = pipeFd;
+    process.server = server;
+    _processes.insert(make_pair(name, process));
+
+    int flags = fcntl(process.pipeFd, F_GETFL);
+    flags |= O_NONBLOCK;
+    fcntl(process.pipeFd, F_SETFL, flags);
+
+    setInterrupt();
+}
+
 int
 Activator::waitPid(pid_t processPid)
 {
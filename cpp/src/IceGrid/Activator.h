@@ -5,6 +5,9 @@
 
 #include "Internal.h"
 
+#include <deque>
+#include <set>
+
 #ifdef _WIN32
 #    include <windows.h>
 #else
@@ -36,7 +39,7 @@ namespace IceGrid
             std::shared_ptr<ServerI> server;
         };
 
-        Activator(const std::shared_ptr<TraceLevels>&);
+        Activator(const std::shared_ptr<TraceLevels>&, int);
         ~Activator();
 
         int activate(
@@ -51,6 +54,9 @@ namespace IceGrid
             const Ice::StringSeq&,
             const std::shared_ptr<ServerI>&);
         void deactivate(const std::string&, const std::optional<Ice::ProcessPrx>&);
+
+        bool reserveActivation(const std::shared_ptr<ServerI>&);
+        std::vector<std::shared_ptr<ServerI>> releaseActivation(const std::string&);
         void kill(const std::string&);
         void sendSignal(const std::string&, const std::string&);
 
@@ -76,12 +82,17 @@ namespace IceGrid
         void setInterrupt();
 
 #ifndef _WIN32
+        void addProcess(const std::string&, pid_t, int, const std::shared_ptr<ServerI>&);
         int waitPid(pid_t);
 #endif
 
         std::shared_ptr<TraceLevels> _traceLevels;
         std::map<std::string, Process> _processes;
         bool _deactivating{false};
+        const int _concurrentActivations;
+        std::set<std::string> _activations;
+        std::deque<std::shared_ptr<ServerI>> _pendingActivations;
+        int _activating{0};
 
 #ifdef _WIN32
         HANDLE _hIntr;
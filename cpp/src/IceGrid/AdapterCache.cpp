@@ -121,6 +121,40 @@ namespace IceGrid
     };
 }
 
+namespace
+{
+    // Sorts the replicas by the number of dispatches in progress and then by dispatch latency, using the live loads
+    // reported by the nodes. Returns false and leaves the replicas untouched if the live load of a replica isn't
+    // available: the live loads can't be compared with the node loads of the other replicas.
+    bool sortByAdapterLoad(vector<shared_ptr<ServerAdapterEntry>>& replicas)
+    {
+        vector<pair<AdapterLoad, shared_ptr<ServerAdapterEntry>>> rl;
+        rl.reserve(replicas.size());
+        for (const auto& replica : replicas)
+        {
+            optional<AdapterLoad> load = replica->getAdapterLoad();
+            if (!load)
+            {
+                return false;
+            }
+            rl.emplace_back(std::move(*load), replica);
+        }
+
+        // An adapter that didn't dispatch any request during the last sampling period has no latency: it's idle.
+        stable_sort(
+            rl.begin(),
+            rl.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return make_pair(lhs.first.inFlight, max(lhs.first.latency, 0.0f)) <
+                       make_pair(rhs.first.inFlight, max(rhs.first.latency, 0.0f));
+            });
+        replicas.clear();
+        transform(rl.begin(), rl.end(), back_inserter(replicas), [](const auto& value) { return value.second; });
+        return true;
+    }
+}
+
 void
 GetAdapterInfoResult::add(const ServerAdapterEntry* adapter)
 {
@@ -158,7 +192,10 @@ GetAdapterInfoResult::get()
     return _adapters;
 }
 
-AdapterCache::AdapterCache(const shared_ptr<Ice::Communicator>& communicator) : _communicator(communicator) {}
+AdapterCache::AdapterCache(const shared_ptr<Ice::Communicator>& communicator) : _communicator(communicator)
+{
+    _snapshot.store(make_shared<const ShardedMap<AdapterEntry>>());
+}
 
 void
 AdapterCache::addServerAdapter(const AdapterDescriptor& desc, const shared_ptr<ServerEntry>& server, const string& app)
@@ -201,6 +238,7 @@ AdapterCache::addServerAdapter(const AdapterDescriptor& desc, const shared_ptr<S
             addImpl(desc.replicaGroupId, repEntry);
         }
         repEntry->addReplica(desc.id, entry);
+        _changedReplicaGroups.insert(repEntry);
     }
 }
 
@@ -218,6 +256,7 @@ AdapterCache::addReplicaGroup(const ReplicaGroupDescriptor& desc, const string&
         if (repEntry->getApplication().empty())
         {
             repEntry->update(app, desc.loadBalancing, desc.filter);
+            _changedReplicaGroups.insert(repEntry);
         }
         else
         {
@@ -226,7 +265,32 @@ AdapterCache::addReplicaGroup(const ReplicaGroupDescriptor& desc, const string&
         }
         return;
     }
-    addImpl(desc.id, make_shared<ReplicaGroupEntry>(*this, desc.id, app, desc.loadBalancing, desc.filter));
+    repEntry = make_shared<ReplicaGroupEntry>(*this, desc.id, app, desc.loadBalancing, desc.filter);
+    addImpl(desc.id, repEntry);
+    _changedReplicaGroups.insert(repEntry);
+}
+
+void
+AdapterCache::updateReplicaGroup(const ReplicaGroupDescriptor& desc, const string& app)
+{
+    lock_guard lock(_mutex);
+    auto repEntry = dynamic_pointer_cast<ReplicaGroupEntry>(getImpl(desc.id));
+    if (!repEntry)
+    {
+        throw AdapterNotExistException(desc.id);
+    }
+
+    // The locator keeps using the published load balancing policy until the update is published.
+    repEntry->update(app, desc.loadBalancing, desc.filter);
+    _changedReplicaGroups.insert(repEntry);
+}
+
+bool
+AdapterCache::isLiveLoadReplicaGroup(const string& id) const
+{
+    lock_guard lock(_mutex);
+    auto entry = dynamic_pointer_cast<ReplicaGroupEntry>(getImpl(id));
+    return entry && entry->isLiveLoad();
 }
 
 shared_ptr<AdapterEntry>
@@ -274,6 +338,7 @@ AdapterCache::removeServerAdapter(const string& id)
             {
                 removeImpl(replicaGroupId);
             }
+            _changedReplicaGroups.insert(repEntry);
         }
     }
 }
@@ -293,9 +358,39 @@ AdapterCache::removeReplicaGroup(const string& id)
     removeImpl(id);
 }
 
+shared_ptr<AdapterEntry>
+AdapterCache::getPublished(const string& id) const
+{
+    auto entry = _snapshot.load()->find(id);
+    if (!entry)
+    {
+        throw AdapterNotExistException(id);
+    }
+    return entry;
+}
+
+void
+AdapterCache::publish()
+{
+    lock_guard lock(_mutex);
+
+    for (const auto& entry : _changedReplicaGroups)
+    {
+        entry->publish();
+    }
+    _changedReplicaGroups.clear();
+
+    if (!_changedEntries.empty())
+    {
+        _snapshot.store(make_shared<const ShardedMap<AdapterEntry>>(_snapshot.load()->apply(_changedEntries)));
+        _changedEntries.clear();
+    }
+}
+
 shared_ptr<AdapterEntry>
 AdapterCache::addImpl(const string& id, const shared_ptr<AdapterEntry>& entry)
 {
+    _changedEntries[id] = entry;
     if (_traceLevels && _traceLevels->adapter > 0)
     {
         Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
@@ -313,6 +408,7 @@ AdapterCache::removeImpl(const string& id)
         out << "removed adapter '" << id << "'";
     }
     Cache<string, AdapterEntry>::removeImpl(id);
+    _changedEntries[id] = getImpl(id); // Null unless the entry can't be removed.
 }
 
 AdapterEntry::AdapterEntry(AdapterCache& cache, string id, string application)
@@ -408,6 +504,32 @@ ServerAdapterEntry::getLeastLoadedNodeLoad(LoadSample loadSample) const
     return 999.9f;
 }
 
+optional<AdapterLoad>
+ServerAdapterEntry::getAdapterLoad() const
+{
+    try
+    {
+        return _server->getAdapterLoad(_id);
+    }
+    catch (const ServerNotExistException&)
+    {
+        // This might happen if the application is updated concurrently.
+    }
+    catch (const NodeNotExistException&)
+    {
+        // This might happen if the application is updated concurrently.
+    }
+    catch (const NodeUnreachableException&)
+    {
+    }
+    catch (const Ice::Exception& ex)
+    {
+        Ice::Error error(_cache.getTraceLevels()->logger);
+        error << "unexpected exception while getting adapter load:\n" << ex;
+    }
+    return nullopt;
+}
+
 AdapterInfoSeq
 ServerAdapterEntry::getAdapterInfoNoEndpoints() const
 {
@@ -483,6 +605,7 @@ ReplicaGroupEntry::ReplicaGroupEntry(
     : AdapterEntry(cache, id, application)
 {
     update(application, policy, filter);
+    publish();
 }
 
 bool
@@ -494,15 +617,15 @@ ReplicaGroupEntry::addSyncCallback(const shared_ptr<SynchronizationCallback>& ca
     {
         lock_guard lock(_mutex);
 
-        nReplicas = _loadBalancingNReplicas > 0 ? _loadBalancingNReplicas : static_cast<int>(_replicas.size());
-        roundRobin = dynamic_pointer_cast<RoundRobinLoadBalancingPolicy>(_loadBalancing) != nullptr;
+        nReplicas = _state.nReplicas > 0 ? _state.nReplicas : static_cast<int>(_state.replicas.size());
+        roundRobin = _state.loadBalancing == LoadBalancing::RoundRobin;
         if (!roundRobin)
         {
-            replicas = _replicas;
+            replicas = _state.replicas;
         }
         else
         {
-            for (const auto& replica : _replicas)
+            for (const auto& replica : _state.replicas)
             {
                 if (excludes.find(replica->getId()) == excludes.end())
                 {
@@ -536,30 +659,35 @@ ReplicaGroupEntry::addSyncCallback(const shared_ptr<SynchronizationCallback>& ca
     return cb->response();
 }
 
+void
+ReplicaGroupEntry::publish()
+{
+    lock_guard lock(_mutex);
+    _published.store(make_shared<const State>(_state));
+}
+
 void
 ReplicaGroupEntry::addReplica(const string& /*replicaId*/, const shared_ptr<ServerAdapterEntry>& adapter)
 {
     lock_guard lock(_mutex);
-    _replicas.push_back(adapter);
+    _state.replicas.push_back(adapter);
 }
 
 bool
 ReplicaGroupEntry::removeReplica(const string& replicaId)
 {
     lock_guard lock(_mutex);
-    for (auto p = _replicas.cbegin(); p != _replicas.cend(); ++p)
+    for (auto p = _state.replicas.cbegin(); p != _state.replicas.cend(); ++p)
     {
         if (replicaId == (*p)->getId())
         {
-            _replicas.erase(p);
-            // Make sure _lastReplica is still within the bounds.
-            _lastReplica = _replicas.empty() ? 0 : _lastReplica % static_cast<int>(_replicas.size());
+            _state.replicas.erase(p);
             break;
         }
     }
 
     // Replica group can be removed if not assigned to an application and there's no more replicas
-    return _replicas.empty() && _application.empty();
+    return _state.replicas.empty() && _application.empty();
 }
 
 void
@@ -573,39 +701,64 @@ ReplicaGroupEntry::update(
     assert(policy);
 
     _application = application;
-    _loadBalancing = policy;
-    _filter = filter;
+    _state.filter = filter;
 
     int nReplicas = 0;
     try
     {
-        nReplicas = stoi(_loadBalancing->nReplicas);
+        nReplicas = stoi(policy->nReplicas);
     }
     catch (const std::exception&)
     {
     }
 
-    _loadBalancingNReplicas = nReplicas < 0 ? 1 : nReplicas;
-    auto alb = dynamic_pointer_cast<AdaptiveLoadBalancingPolicy>(_loadBalancing);
-    if (alb)
+    _state.nReplicas = nReplicas < 0 ? 1 : nReplicas;
+    _state.liveLoad = false;
+    _state.loadSample = LoadSample::LoadSample1;
+    if (auto alb = dynamic_pointer_cast<AdaptiveLoadBalancingPolicy>(policy))
     {
-        if (alb->loadSample == "1")
+        _state.loadBalancing = LoadBalancing::Adaptive;
+        if (alb->loadSample == "live")
         {
-            _loadSample = LoadSample::LoadSample1;
+            // Fallback for replicas without a live load.
+            _state.loadSample = LoadSample::LoadSample1;
+            _state.liveLoad = true;
         }
         else if (alb->loadSample == "5")
         {
-            _loadSample = LoadSample::LoadSample5;
+            _state.loadSample = LoadSample::LoadSample5;
         }
         else if (alb->loadSample == "15")
         {
-            _loadSample = LoadSample::LoadSample15;
-        }
-        else
-        {
-            _loadSample = LoadSample::LoadSample1;
+            _state.loadSample = LoadSample::LoadSample15;
         }
     }
+    else if (dynamic_pointer_cast<RoundRobinLoadBalancingPolicy>(policy))
+    {
+        _state.loadBalancing = LoadBalancing::RoundRobin;
+    }
+    else if (dynamic_pointer_cast<OrderedLoadBalancingPolicy>(policy))
+    {
+        _state.loadBalancing = LoadBalancing::Ordered;
+    }
+    else
+    {
+        _state.loadBalancing = LoadBalancing::Random;
+    }
+}
+
+string
+ReplicaGroupEntry::getFilter() const
+{
+    lock_guard lock(_mutex);
+    return _state.filter;
+}
+
+bool
+ReplicaGroupEntry::isLiveLoad() const
+{
+    lock_guard lock(_mutex);
+    return _state.liveLoad;
 }
 
 void
@@ -617,133 +770,120 @@ ReplicaGroupEntry::getLocatorAdapterInfo(
     string& filter,
     const set<string>& excludes)
 {
+    // The published state is immutable: concurrent requests don't lock the replica group.
+    const auto state = _published.load();
+    replicaGroup = true;
+    roundRobin = false;
+    filter = state->filter;
+    nReplicas = state->nReplicas > 0 ? state->nReplicas : static_cast<int>(state->replicas.size());
+
+    if (state->replicas.empty())
+    {
+        return;
+    }
+
     vector<shared_ptr<ServerAdapterEntry>> replicas;
     bool adaptive = false;
-    LoadSample loadSample = LoadSample::LoadSample1;
+    switch (state->loadBalancing)
     {
-        unique_lock lock(_mutex);
-        replicaGroup = true;
-        roundRobin = false;
-        filter = _filter;
-        nReplicas = _loadBalancingNReplicas > 0 ? _loadBalancingNReplicas : static_cast<int>(_replicas.size());
-
-        if (_replicas.empty())
+        case LoadBalancing::RoundRobin:
         {
-            return;
-        }
-
-        replicas.reserve(_replicas.size());
-        if (dynamic_pointer_cast<RoundRobinLoadBalancingPolicy>(_loadBalancing))
-        {
-            // Serialize round-robin requests
-            _condVar.wait(lock, [this] { return !_requestInProgress; });
-            _requestInProgress = true;
-            for (size_t i = 0; i < _replicas.size(); ++i)
+            // Each request starts with the replica following the first replica of the previous request.
+            const size_t size = state->replicas.size();
+            const size_t first = _lastReplica.fetch_add(1) % size;
+            replicas.reserve(size);
+            for (size_t i = 0; i < size; ++i)
             {
-                replicas.push_back(_replicas[(static_cast<size_t>(_lastReplica) + i) % _replicas.size()]);
+                replicas.push_back(state->replicas[(first + i) % size]);
             }
-            _lastReplica = (_lastReplica + 1) % static_cast<int>(_replicas.size());
             roundRobin = true;
+            break;
         }
-        else if (dynamic_pointer_cast<AdaptiveLoadBalancingPolicy>(_loadBalancing))
+        case LoadBalancing::Adaptive:
         {
-            replicas = _replicas;
+            replicas = state->replicas;
             IceInternal::shuffle(replicas.begin(), replicas.end());
-            loadSample = _loadSample;
             adaptive = true;
+            break;
         }
-        else if (dynamic_pointer_cast<OrderedLoadBalancingPolicy>(_loadBalancing))
+        case LoadBalancing::Ordered:
         {
-            replicas = _replicas;
+            replicas = state->replicas;
             sort(
                 replicas.begin(),
                 replicas.end(),
                 [](const auto& lhs, const auto& rhs) { return lhs->getPriority() < rhs->getPriority(); });
+            break;
         }
-        else if (dynamic_pointer_cast<RandomLoadBalancingPolicy>(_loadBalancing))
+        case LoadBalancing::Random:
         {
-            replicas = _replicas;
+            replicas = state->replicas;
             IceInternal::shuffle(replicas.begin(), replicas.end());
+            break;
         }
     }
 
-    int unreachable = 0;
-    bool synchronizing = false;
-    try
+    if (adaptive && state->liveLoad)
     {
-        if (adaptive)
-        {
-            //
-            // This must be done outside the synchronization block since
-            // the transform() might call and lock each server adapter
-            // entry. We also can't sort directly as the load of each
-            // server adapter is not stable so we first take a snapshot of
-            // each adapter and sort the snapshot.
-            //
-            vector<pair<float, shared_ptr<ServerAdapterEntry>>> rl;
-            transform(
-                replicas.begin(),
-                replicas.end(),
-                back_inserter(rl),
-                [loadSample](const auto& value) -> pair<float, shared_ptr<ServerAdapterEntry>>
-                { return {value->getLeastLoadedNodeLoad(loadSample), value}; });
-            sort(rl.begin(), rl.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
-            replicas.clear();
-            transform(rl.begin(), rl.end(), back_inserter(replicas), [](const auto& value) { return value.second; });
-        }
+        // Fall back to the node load if the live load of a replica isn't available.
+        adaptive = !sortByAdapterLoad(replicas);
+    }
 
+    if (adaptive)
+    {
         //
-        // Retrieve the proxy of each adapter from the server. The adapter
-        // might not exist anymore at this time or the node might not be
-        // reachable.
+        // We can't sort directly as the load of each server adapter is
+        // not stable so we first take a snapshot of each adapter and
+        // sort the snapshot.
         //
-        set<string> emptyExcludes;
-        bool firstUnreachable = true;
-        for (const auto& replica : replicas)
+        const LoadSample loadSample = state->loadSample;
+        vector<pair<float, shared_ptr<ServerAdapterEntry>>> rl;
+        transform(
+            replicas.begin(),
+            replicas.end(),
+            back_inserter(rl),
+            [loadSample](const auto& value) -> pair<float, shared_ptr<ServerAdapterEntry>>
+            { return {value->getLeastLoadedNodeLoad(loadSample), value}; });
+        sort(rl.begin(), rl.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        replicas.clear();
+        transform(rl.begin(), rl.end(), back_inserter(replicas), [](const auto& value) { return value.second; });
+    }
+
+    //
+    // Retrieve the proxy of each adapter from the server. The adapter
+    // might not exist anymore at this time or the node might not be
+    // reachable.
+    //
+    int unreachable = 0;
+    bool synchronizing = false;
+    bool firstUnreachable = true;
+    for (const auto& replica : replicas)
+    {
+        if (!roundRobin || excludes.find(replica->getId()) == excludes.end())
         {
-            if (!roundRobin || excludes.find(replica->getId()) == excludes.end())
+            try
             {
-                try
-                {
-                    replica->getLocatorAdapterInfo(adapters);
-                    firstUnreachable = false;
-                }
-                catch (const SynchronizationException&)
-                {
-                    synchronizing = true;
-                }
-                catch (const Ice::UserException&)
+                replica->getLocatorAdapterInfo(adapters);
+                firstUnreachable = false;
+            }
+            catch (const SynchronizationException&)
+            {
+                synchronizing = true;
+            }
+            catch (const Ice::UserException&)
+            {
+                if (firstUnreachable)
                 {
-                    if (firstUnreachable)
-                    {
-                        ++unreachable; // Count the number of un-reachable nodes.
-                    }
+                    ++unreachable; // Count the number of un-reachable nodes.
                 }
             }
         }
     }
-    catch (const std::exception&)
-    {
-        if (roundRobin)
-        {
-            lock_guard lock(_mutex);
-            assert(_requestInProgress);
-            _requestInProgress = false;
-            _condVar.notify_one();
-        }
-        throw;
-    }
 
-    if (roundRobin)
+    if (roundRobin && unreachable > 0)
     {
-        lock_guard lock(_mutex);
-        assert(_requestInProgress);
-        _requestInProgress = false;
-        _condVar.notify_one();
-        if (unreachable > 0)
-        {
-            _lastReplica = (_lastReplica + unreachable) % static_cast<int>(_replicas.size());
-        }
+        // Skip the unreachable replicas on the next requests.
+        _lastReplica.fetch_add(static_cast<size_t>(unreachable));
     }
 
     if (adapters.empty() && synchronizing)
@@ -758,7 +898,7 @@ ReplicaGroupEntry::getLeastLoadedNodeLoad(LoadSample loadSample) const
     vector<shared_ptr<ServerAdapterEntry>> replicas;
     {
         lock_guard lock(_mutex);
-        replicas = _replicas;
+        replicas = _state.replicas;
     }
 
     if (replicas.empty())
@@ -794,7 +934,7 @@ ReplicaGroupEntry::getAdapterInfoNoEndpoints() const
     vector<shared_ptr<ServerAdapterEntry>> replicas;
     {
         lock_guard lock(_mutex);
-        replicas = _replicas;
+        replicas = _state.replicas;
     }
 
     AdapterInfoSeq infos;
@@ -814,7 +954,7 @@ ReplicaGroupEntry::getAdapterInfoAsync() const
     vector<shared_ptr<ServerAdapterEntry>> replicas;
     {
         lock_guard lock(_mutex);
-        replicas = _replicas;
+        replicas = _state.replicas;
     }
     for (const auto& replica : replicas)
     {
@@ -829,7 +969,7 @@ ReplicaGroupEntry::hasAdaptersFromOtherApplications() const
     vector<shared_ptr<ServerAdapterEntry>> replicas;
     {
         lock_guard lock(_mutex);
-        replicas = _replicas;
+        replicas = _state.replicas;
     }
 
     AdapterInfoSeq infos;
@@ -6,7 +6,9 @@
 #include "Cache.h"
 #include "IceGrid/Registry.h"
 #include "Internal.h"
+#include "Snapshot.h"
 
+#include <atomic>
 #include <optional>
 #include <set>
 
@@ -93,6 +95,10 @@ namespace IceGrid
         [[nodiscard]] std::optional<AdapterPrx> getProxy(const std::string&, bool) const final;
 
         void getLocatorAdapterInfo(LocatorAdapterInfoSeq&) const;
+
+        // Returns the live load of the adapter reported by its node, or nullopt if it's not available.
+        [[nodiscard]] std::optional<AdapterLoad> getAdapterLoad() const;
+
         [[nodiscard]] const std::string& getReplicaGroupId() const { return _replicaGroupId; }
         [[nodiscard]] int getPriority() const;
 
@@ -128,22 +134,43 @@ namespace IceGrid
         void addReplica(const std::string&, const std::shared_ptr<ServerAdapterEntry>&);
         bool removeReplica(const std::string&);
 
+        // Makes the current replicas and load balancing policy visible to getLocatorAdapterInfo.
+        void publish();
+
         void update(const std::string&, const std::shared_ptr<LoadBalancingPolicy>&, const std::string&);
         [[nodiscard]] bool hasAdaptersFromOtherApplications() const;
 
-        [[nodiscard]] const std::string& getFilter() const { return _filter; }
+        [[nodiscard]] std::string getFilter() const;
+        [[nodiscard]] bool isLiveLoad() const;
 
     private:
-        std::shared_ptr<LoadBalancingPolicy> _loadBalancing;
-        int _loadBalancingNReplicas;
-        LoadSample _loadSample;
-        std::string _filter;
-        std::vector<std::shared_ptr<ServerAdapterEntry>> _replicas;
-        int _lastReplica{0};
-        bool _requestInProgress{false};
+        enum class LoadBalancing
+        {
+            Random,
+            RoundRobin,
+            Adaptive,
+            Ordered
+        };
+
+        // The replicas and load balancing settings of the group. getLocatorAdapterInfo reads the published state,
+        // the other methods and the updates use the current state.
+        struct State
+        {
+            LoadBalancing loadBalancing{LoadBalancing::Random};
+            int nReplicas{0};
+            LoadSample loadSample{LoadSample::LoadSample1};
+            bool liveLoad{false};
+            std::string filter;
+            std::vector<std::shared_ptr<ServerAdapterEntry>> replicas;
+        };
+
+        State _state;
+        PublishedPtr<State> _published;
+
+        // The first replica of the next round-robin request, modulo the number of published replicas.
+        std::atomic<size_t> _lastReplica{0};
 
         mutable std::mutex _mutex;
-        std::condition_variable _condVar;
     };
 
     class AdapterCache : public CacheByString<AdapterEntry>
@@ -156,6 +183,19 @@ namespace IceGrid
 
         [[nodiscard]] std::shared_ptr<AdapterEntry> get(const std::string&) const;
 
+        // Returns the entry from the latest published snapshot, without locking the cache. The locator uses the
+        // published snapshot to never observe an application update in progress.
+        [[nodiscard]] std::shared_ptr<AdapterEntry> getPublished(const std::string&) const;
+
+        // Publishes a snapshot of the current entries and the current state of the modified replica groups. The
+        // database calls this once the cache reflects a complete application update.
+        void publish();
+
+        void updateReplicaGroup(const ReplicaGroupDescriptor&, const std::string&);
+
+        // Returns whether the given replica group uses the adaptive load balancing policy with the live load sample.
+        [[nodiscard]] bool isLiveLoadReplicaGroup(const std::string&) const;
+
         void removeServerAdapter(const std::string&);
         void removeReplicaGroup(const std::string&);
 
@@ -165,6 +205,12 @@ namespace IceGrid
 
     private:
         const Ice::CommunicatorPtr _communicator;
+
+        // The entries added or removed (null) since the last publication. A publication applies them to the previous
+        // snapshot, and shares the unmodified shards with it.
+        std::map<std::string, std::shared_ptr<AdapterEntry>> _changedEntries;
+        std::set<std::shared_ptr<ReplicaGroupEntry>> _changedReplicaGroups;
+        PublishedPtr<ShardedMap<AdapterEntry>> _snapshot;
     };
 
 };
@@ -206,7 +206,11 @@ Database::Database(
       _master(info.name == "Master"),
       _readonly(readonly || !_master),
       _replicaCache(_communicator, _topicManager),
-      _nodeCache(_communicator, _replicaCache, _readonly && _master ? string("Master (read-only)") : info.name),
+      _nodeCache(
+          _communicator,
+          _replicaCache,
+          _adapterCache,
+          _readonly && _master ? string("Master (read-only)") : info.name),
       _adapterCache(_communicator),
       _objectCache(_communicator),
       _allocatableObjectCache(_communicator),
@@ -216,6 +220,7 @@ Database::Database(
           _communicator->getProperties()->getIceProperty("IceGrid.Registry.LMDB.Path"),
           8,
           IceDB::getMapSize(_communicator->getProperties()->getIcePropertyAsInt("IceGrid.Registry.LMDB.MapSize"))),
+      _groupCommit(_env),
       _pluginFacade(dynamic_pointer_cast<RegistryPluginFacadeI>(getRegistryPluginFacade()))
 {
     IceDB::ReadWriteTxn txn(_env);
@@ -260,7 +265,10 @@ Database::Database(
     _objectCache.setTraceLevels(_traceLevels);
     _allocatableObjectCache.setTraceLevels(_traceLevels);
 
-    _nodeObserverTopic = NodeObserverTopic::create(_topicManager, _internalAdapter);
+    const int updatePeriod = _communicator->getProperties()->getIcePropertyAsInt(
+        "IceGrid.Registry.NodeObserverUpdatePeriod");
+    _nodeObserverTopic =
+        NodeObserverTopic::create(_topicManager, _internalAdapter, chrono::milliseconds(max(updatePeriod, 0)));
     _registryObserverTopic = make_shared<RegistryObserverTopic>(_topicManager);
 
     _serverCache.setNodeObserverTopic(_nodeObserverTopic);
@@ -289,7 +297,7 @@ Database::Database(
     _objectObserverTopic =
         make_shared<ObjectObserverTopic>(_topicManager, toMap(txn, _objects), getSerial(txn, objectsDbName));
 
-    txn.commit();
+    _groupCommit.sync(_groupCommit.commit(txn));
 
     _registryObserverTopic->registryUp(info);
 }
@@ -388,13 +396,14 @@ Database::syncApplications(const ApplicationInfoSeq& newApplications, int64_t db
 
             oldApplications = toMap(txn, _applications);
             _applications.clear(txn);
+            _applicationInstances.clear();
             for (const auto& newApplication : newApplications)
             {
                 _applications.put(txn, newApplication.descriptor.name, newApplication);
             }
             dbSerial = updateSerial(txn, applicationsDbName, dbSerial);
 
-            txn.commit();
+            _groupCommit.sync(_groupCommit.commit(txn));
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -462,6 +471,7 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, int64_t dbSerial)
 {
     assert(dbSerial != 0);
     int serial = 0;
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         try
@@ -476,7 +486,8 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, int64_t dbSerial)
             }
             dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
+            _groupCommit.sync(commit);
         }
         catch (const IceDB::KeyTooLongException&)
         {
@@ -494,6 +505,7 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, int64_t dbSerial)
             out << "synchronized adapters (serial = '" << dbSerial << "')";
         }
 
+        runNotifications(commit);
         serial = _adapterObserverTopic->adapterInit(dbSerial, adapters);
     }
     _adapterObserverTopic->waitForSyncedSubscribers(serial);
@@ -504,6 +516,7 @@ Database::syncObjects(const ObjectInfoSeq& objects, int64_t dbSerial)
 {
     assert(dbSerial != 0);
     int serial = 0;
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         try
@@ -518,7 +531,8 @@ Database::syncObjects(const ObjectInfoSeq& objects, int64_t dbSerial)
             }
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
+            _groupCommit.sync(commit);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -532,6 +546,7 @@ Database::syncObjects(const ObjectInfoSeq& objects, int64_t dbSerial)
             out << "synchronized objects (serial = '" << dbSerial << "')";
         }
 
+        runNotifications(commit);
         serial = _objectObserverTopic->objectInit(dbSerial, objects);
     }
     _objectObserverTopic->waitForSyncedSubscribers(serial);
@@ -616,13 +631,14 @@ Database::addApplication(const ApplicationInfo& info, AdminSessionI* session, in
             throw DeploymentException("application '" + info.descriptor.name + "' already exists");
         }
 
-        ApplicationHelper helper(_communicator, info.descriptor, true);
-        checkForAddition(helper, txn);
+        auto helper = make_shared<const ApplicationHelper>(_communicator, info.descriptor, true);
+        checkForAddition(*helper, txn);
         dbSerial = saveApplication(info, txn, dbSerial);
 
-        txn.commit();
+        _groupCommit.sync(_groupCommit.commit(txn));
 
-        load(helper, entries, info.uuid, info.revision);
+        _applicationInstances[info.descriptor.name] = {info.uuid, info.revision, helper};
+        load(*helper, entries, info.uuid, info.revision);
         startUpdating(info.descriptor.name, info.uuid, info.revision);
 
         for (const auto& entry : entries)
@@ -677,11 +693,12 @@ Database::addApplication(const ApplicationInfo& info, AdminSessionI* session, in
             {
                 lock_guard lock(_mutex);
                 entries.clear();
+                _applicationInstances.erase(info.descriptor.name);
                 unload(ApplicationHelper(_communicator, info.descriptor), entries);
 
                 IceDB::ReadWriteTxn txn(_env);
                 dbSerial = removeApplication(info.descriptor.name, txn);
-                txn.commit();
+                _groupCommit.sync(_groupCommit.commit(txn));
 
                 for (const auto& entry : entries)
                 {
@@ -725,8 +742,8 @@ Database::updateApplication(const ApplicationUpdateInfo& updt, bool noRestart, A
 
     ApplicationInfo oldApp;
     ApplicationUpdateInfo update = updt;
-    unique_ptr<ApplicationHelper> previous;
-    unique_ptr<ApplicationHelper> helper;
+    shared_ptr<const ApplicationHelper> previous;
+    shared_ptr<const ApplicationHelper> helper;
     try
     {
         unique_lock lock(_mutex);
@@ -746,8 +763,13 @@ Database::updateApplication(const ApplicationUpdateInfo& updt, bool noRestart, A
             update.revision = oldApp.revision + 1;
         }
 
-        previous = make_unique<ApplicationHelper>(_communicator, oldApp.descriptor);
-        helper = make_unique<ApplicationHelper>(_communicator, previous->update(update.descriptor), true);
+        previous = getApplicationHelper(oldApp);
+        helper = make_shared<const ApplicationHelper>(
+            _communicator,
+            previous->update(update.descriptor),
+            true,
+            true,
+            previous.get());
 
         startUpdating(update.descriptor.name, oldApp.uuid, oldApp.revision + 1);
     }
@@ -757,7 +779,7 @@ Database::updateApplication(const ApplicationUpdateInfo& updt, bool noRestart, A
         throw;
     }
 
-    finishApplicationUpdate(update, oldApp, *previous.get(), *helper.get(), session, noRestart, dbSerial);
+    finishApplicationUpdate(update, oldApp, previous, helper, session, noRestart, dbSerial);
 }
 
 void
@@ -767,8 +789,8 @@ Database::syncApplicationDescriptor(const ApplicationDescriptor& newDesc, bool n
 
     ApplicationUpdateInfo update;
     ApplicationInfo oldApp;
-    unique_ptr<ApplicationHelper> previous;
-    unique_ptr<ApplicationHelper> helper;
+    shared_ptr<const ApplicationHelper> previous;
+    shared_ptr<const ApplicationHelper> helper;
     try
     {
         unique_lock lock(_mutex);
@@ -783,8 +805,8 @@ Database::syncApplicationDescriptor(const ApplicationDescriptor& newDesc, bool n
             throw ApplicationNotExistException(newDesc.name);
         }
 
-        previous = make_unique<ApplicationHelper>(_communicator, oldApp.descriptor);
-        helper = make_unique<ApplicationHelper>(_communicator, newDesc, true);
+        previous = getApplicationHelper(oldApp);
+        helper = make_shared<const ApplicationHelper>(_communicator, newDesc, true, true, previous.get());
 
         update.updateTime =
             chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
@@ -800,7 +822,7 @@ Database::syncApplicationDescriptor(const ApplicationDescriptor& newDesc, bool n
         throw;
     }
 
-    finishApplicationUpdate(update, oldApp, *previous.get(), *helper.get(), session, noRestart);
+    finishApplicationUpdate(update, oldApp, previous, helper, session, noRestart);
 }
 
 void
@@ -814,8 +836,8 @@ Database::instantiateServer(
 
     ApplicationUpdateInfo update;
     ApplicationInfo oldApp;
-    unique_ptr<ApplicationHelper> previous;
-    unique_ptr<ApplicationHelper> helper;
+    shared_ptr<const ApplicationHelper> previous;
+    shared_ptr<const ApplicationHelper> helper;
 
     try
     {
@@ -831,8 +853,13 @@ Database::instantiateServer(
             throw ApplicationNotExistException(application);
         }
 
-        previous = make_unique<ApplicationHelper>(_communicator, oldApp.descriptor);
-        helper = make_unique<ApplicationHelper>(_communicator, previous->instantiateServer(node, instance), true);
+        previous = getApplicationHelper(oldApp);
+        helper = make_shared<const ApplicationHelper>(
+            _communicator,
+            previous->instantiateServer(node, instance),
+            true,
+            true,
+            previous.get());
 
         update.updateTime =
             chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
@@ -848,7 +875,7 @@ Database::instantiateServer(
         throw;
     }
 
-    finishApplicationUpdate(update, oldApp, *previous.get(), *helper.get(), session, true);
+    finishApplicationUpdate(update, oldApp, previous, helper, session, true);
 }
 
 void
@@ -877,10 +904,10 @@ Database::removeApplication(const string& name, AdminSessionI* session, int64_t
         bool init = false;
         try
         {
-            ApplicationHelper helper(_communicator, appInfo.descriptor);
+            auto helper = getApplicationHelper(appInfo);
             init = true;
-            checkForRemove(helper);
-            unload(helper, entries);
+            checkForRemove(*helper);
+            unload(*helper, entries);
         }
         catch (const DeploymentException&)
         {
@@ -891,8 +918,9 @@ Database::removeApplication(const string& name, AdminSessionI* session, int64_t
         }
         dbSerial = removeApplication(name, txn, dbSerial);
 
-        txn.commit();
+        _groupCommit.sync(_groupCommit.commit(txn));
 
+        _applicationInstances.erase(name);
         startUpdating(name, appInfo.uuid, appInfo.revision);
 
         for (const auto& entry : entries)
@@ -1023,7 +1051,8 @@ Database::setAdapterDirectProxy(
 {
     assert(dbSerial != 0 || _master);
 
-    int serial = 0; // Initialize to prevent warning.
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         if (_adapterCache.has(adapterId))
@@ -1068,7 +1097,7 @@ Database::setAdapterDirectProxy(
             }
             dbSerial = updateSerial(txn, adaptersDbName, dbSerial);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::KeyTooLongException&)
         {
@@ -1091,23 +1120,30 @@ Database::setAdapterDirectProxy(
             out << " (serial = '" << dbSerial << "')";
         }
 
-        if (info.proxy)
-        {
-            if (updated)
-            {
-                serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
-            }
-            else
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, info, updated]
             {
-                serial = _adapterObserverTopic->adapterAdded(dbSerial, info);
-            }
-        }
-        else
-        {
-            serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
-        }
+                if (info.proxy)
+                {
+                    if (updated)
+                    {
+                        *serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
+                    }
+                    else
+                    {
+                        *serial = _adapterObserverTopic->adapterAdded(dbSerial, info);
+                    }
+                }
+                else
+                {
+                    *serial = _adapterObserverTopic->adapterRemoved(dbSerial, info.id);
+                }
+            });
     }
-    _adapterObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _adapterObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 optional<Ice::ObjectPrx>
@@ -1153,7 +1189,8 @@ Database::removeAdapter(const string& adapterId)
 {
     assert(_master);
 
-    int serial = 0; // Initialize to prevent warning.
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         if (_adapterCache.has(adapterId))
@@ -1192,7 +1229,7 @@ Database::removeAdapter(const string& adapterId)
             }
             dbSerial = updateSerial(txn, adaptersDbName);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::KeyTooLongException&)
         {
@@ -1211,19 +1248,26 @@ Database::removeAdapter(const string& adapterId)
                 << dbSerial << "')";
         }
 
-        if (infos.empty())
-        {
-            serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
-        }
-        else
-        {
-            for (const AdapterInfo& info : infos)
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, adapterId, infos]
             {
-                serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
-            }
-        }
+                if (infos.empty())
+                {
+                    *serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
+                }
+                else
+                {
+                    for (const AdapterInfo& info : infos)
+                    {
+                        *serial = _adapterObserverTopic->adapterUpdated(dbSerial, info);
+                    }
+                }
+            });
     }
-    _adapterObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _adapterObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 optional<AdapterPrx>
@@ -1244,11 +1288,9 @@ Database::getLocatorAdapterInfo(
     bool& roundRobin,
     const set<string>& excludes)
 {
+    // The published snapshot only reflects complete application updates, there's no need to lock the database.
     string filter;
-    {
-        lock_guard lock(_mutex); // Make sure this isn't called during an update.
-        _adapterCache.get(id)->getLocatorAdapterInfo(adpts, count, replicaGroup, roundRobin, filter, excludes);
-    }
+    _adapterCache.getPublished(id)->getLocatorAdapterInfo(adpts, count, replicaGroup, roundRobin, filter, excludes);
 
     if (_pluginFacade->hasReplicaGroupFilters() && !adpts.empty())
     {
@@ -1486,7 +1528,8 @@ Database::addObject(const ObjectInfo& info)
 {
     assert(_master);
 
-    int serial = 0;
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         const Ice::Identity id = info.proxy->ice_getIdentity();
@@ -1508,7 +1551,7 @@ Database::addObject(const ObjectInfo& info)
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1516,7 +1559,9 @@ Database::addObject(const ObjectInfo& info)
             throw;
         }
 
-        serial = _objectObserverTopic->objectAdded(dbSerial, info);
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, info] { *serial = _objectObserverTopic->objectAdded(dbSerial, info); });
 
         if (_traceLevels->object > 0)
         {
@@ -1524,7 +1569,9 @@ Database::addObject(const ObjectInfo& info)
             out << "added object '" << _communicator->identityToString(id) << "' (serial = '" << dbSerial << "')";
         }
     }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _objectObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 void
@@ -1532,7 +1579,8 @@ Database::addOrUpdateObject(const ObjectInfo& info, int64_t dbSerial)
 {
     assert(dbSerial != 0 || _master);
 
-    int serial = 0; // Initialize to prevent warning.
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         const Ice::Identity id = info.proxy->ice_getIdentity();
@@ -1556,7 +1604,7 @@ Database::addOrUpdateObject(const ObjectInfo& info, int64_t dbSerial)
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1564,14 +1612,19 @@ Database::addOrUpdateObject(const ObjectInfo& info, int64_t dbSerial)
             throw;
         }
 
-        if (update)
-        {
-            serial = _objectObserverTopic->objectUpdated(dbSerial, info);
-        }
-        else
-        {
-            serial = _objectObserverTopic->objectAdded(dbSerial, info);
-        }
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, info, update]
+            {
+                if (update)
+                {
+                    *serial = _objectObserverTopic->objectUpdated(dbSerial, info);
+                }
+                else
+                {
+                    *serial = _objectObserverTopic->objectAdded(dbSerial, info);
+                }
+            });
 
         if (_traceLevels->object > 0)
         {
@@ -1580,7 +1633,9 @@ Database::addOrUpdateObject(const ObjectInfo& info, int64_t dbSerial)
                 << "' (serial = '" << dbSerial << "')";
         }
     }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _objectObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 void
@@ -1588,7 +1643,8 @@ Database::removeObject(const Ice::Identity& id, int64_t dbSerial)
 {
     assert(dbSerial != 0 || _master);
 
-    int serial = 0; // Initialize to prevent warning.
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
         if (_objectCache.has(id))
@@ -1610,7 +1666,7 @@ Database::removeObject(const Ice::Identity& id, int64_t dbSerial)
             deleteObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1618,7 +1674,9 @@ Database::removeObject(const Ice::Identity& id, int64_t dbSerial)
             throw;
         }
 
-        serial = _objectObserverTopic->objectRemoved(dbSerial, id);
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, id] { *serial = _objectObserverTopic->objectRemoved(dbSerial, id); });
 
         if (_traceLevels->object > 0)
         {
@@ -1626,7 +1684,9 @@ Database::removeObject(const Ice::Identity& id, int64_t dbSerial)
             out << "removed object '" << _communicator->identityToString(id) << "' (serial = '" << dbSerial << "')";
         }
     }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _objectObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 void
@@ -1634,7 +1694,8 @@ Database::updateObject(Ice::ObjectPrx proxy)
 {
     assert(_master);
 
-    int serial = 0;
+    auto serial = make_shared<int>(0);
+    uint64_t commit = 0;
     {
         lock_guard lock(_mutex);
 
@@ -1661,7 +1722,7 @@ Database::updateObject(Ice::ObjectPrx proxy)
             addObject(txn, info, false);
             dbSerial = updateSerial(txn, objectsDbName);
 
-            txn.commit();
+            commit = _groupCommit.commit(txn);
         }
         catch (const IceDB::LMDBException& ex)
         {
@@ -1669,20 +1730,25 @@ Database::updateObject(Ice::ObjectPrx proxy)
             throw;
         }
 
-        serial = _objectObserverTopic->objectUpdated(dbSerial, info);
+        queueNotification(
+            commit,
+            [this, serial, dbSerial, info] { *serial = _objectObserverTopic->objectUpdated(dbSerial, info); });
         if (_traceLevels->object > 0)
         {
             Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
             out << "updated object '" << _communicator->identityToString(id) << "' (serial = '" << dbSerial << "')";
         }
     }
-    _objectObserverTopic->waitForSyncedSubscribers(serial);
+    _groupCommit.sync(commit);
+    runNotifications(commit);
+    _objectObserverTopic->waitForSyncedSubscribers(*serial);
 }
 
 int
 Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
 {
     lock_guard lock(_mutex);
+    uint64_t commit = 0;
     try
     {
         IceDB::ReadWriteTxn txn(_env);
@@ -1696,7 +1762,8 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             }
             addObject(txn, obj, false);
         }
-        txn.commit();
+        commit = _groupCommit.commit(txn);
+        _groupCommit.sync(commit);
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -1704,6 +1771,7 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
         throw;
     }
 
+    runNotifications(commit);
     return _objectObserverTopic->wellKnownObjectsAddedOrUpdated(objects);
 }
 
@@ -1711,6 +1779,7 @@ int
 Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
 {
     lock_guard lock(_mutex);
+    uint64_t commit = 0;
     try
     {
         IceDB::ReadWriteTxn txn(_env);
@@ -1723,7 +1792,8 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
                 deleteObject(txn, info, false);
             }
         }
-        txn.commit();
+        commit = _groupCommit.commit(txn);
+        _groupCommit.sync(commit);
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -1731,6 +1801,7 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
         throw;
     }
 
+    runNotifications(commit);
     return _objectObserverTopic->wellKnownObjectsRemoved(objects);
 }
 
@@ -1912,7 +1983,7 @@ Database::addInternalObject(const ObjectInfo& info)
         }
         addObject(txn, info, true);
 
-        txn.commit();
+        _groupCommit.sync(_groupCommit.commit(txn));
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -1937,7 +2008,7 @@ Database::removeInternalObject(const Ice::Identity& id)
         }
         deleteObject(txn, info, true);
 
-        txn.commit();
+        _groupCommit.sync(_groupCommit.commit(txn));
     }
     catch (const IceDB::LMDBException& ex)
     {
@@ -2221,6 +2292,9 @@ Database::load(const ApplicationHelper& app, ServerEntrySeq& entries, const stri
     {
         entries.push_back(_serverCache.add(server.second));
     }
+
+    _adapterCache.publish();
+    _objectCache.publish();
 }
 
 void
@@ -2246,6 +2320,9 @@ Database::unload(const ApplicationHelper& app, ServerEntrySeq& entries)
     {
         _nodeCache.get(node.first)->removeDescriptor(application);
     }
+
+    _adapterCache.publish();
+    _objectCache.publish();
 }
 
 void
@@ -2343,9 +2420,7 @@ Database::reload(
     {
         try
         {
-            auto entry = dynamic_pointer_cast<ReplicaGroupEntry>(_adapterCache.get(newAdpt.id));
-            assert(entry);
-            entry->update(application, newAdpt.loadBalancing, newAdpt.filter);
+            _adapterCache.updateReplicaGroup(newAdpt, application);
         }
         catch (const AdapterNotExistException&)
         {
@@ -2372,6 +2447,24 @@ Database::reload(
             entries.push_back(_serverCache.add(q.second));
         }
     }
+
+    _adapterCache.publish();
+    _objectCache.publish();
+}
+
+shared_ptr<const ApplicationHelper>
+Database::getApplicationHelper(const ApplicationInfo& info)
+{
+    // Must be called with _mutex locked.
+    auto p = _applicationInstances.find(info.descriptor.name);
+    if (p != _applicationInstances.end() && p->second.uuid == info.uuid && p->second.revision == info.revision)
+    {
+        return p->second.helper;
+    }
+
+    auto helper = make_shared<const ApplicationHelper>(_communicator, info.descriptor);
+    _applicationInstances[info.descriptor.name] = {info.uuid, info.revision, helper};
+    return helper;
 }
 
 int64_t
@@ -2572,13 +2665,13 @@ void
 Database::finishApplicationUpdate(
     const ApplicationUpdateInfo& update,
     const ApplicationInfo& oldApp,
-    const ApplicationHelper& previousAppHelper,
-    const ApplicationHelper& appHelper,
+    const shared_ptr<const ApplicationHelper>& previousAppHelper,
+    const shared_ptr<const ApplicationHelper>& appHelper,
     AdminSessionI* /*session*/,
     bool noRestart,
     int64_t dbSerial)
 {
-    const ApplicationDescriptor& newDesc = appHelper.getDefinition();
+    const ApplicationDescriptor& newDesc = appHelper->getDefinition();
 
     ServerEntrySeq entries;
     int serial = 0;
@@ -2586,15 +2679,15 @@ Database::finishApplicationUpdate(
     {
         if (_master)
         {
-            checkUpdate(previousAppHelper, appHelper, oldApp.uuid, oldApp.revision, noRestart);
+            checkUpdate(*previousAppHelper, *appHelper, oldApp.uuid, oldApp.revision, noRestart);
         }
 
         lock_guard lock(_mutex);
 
         IceDB::ReadWriteTxn txn(_env);
 
-        checkForUpdate(previousAppHelper, appHelper, txn);
-        reload(previousAppHelper, appHelper, entries, oldApp.uuid, oldApp.revision + 1, noRestart);
+        checkForUpdate(*previousAppHelper, *appHelper, txn);
+        reload(*previousAppHelper, *appHelper, entries, oldApp.uuid, oldApp.revision + 1, noRestart);
 
         for (const auto& entry : entries)
         {
@@ -2608,8 +2701,9 @@ Database::finishApplicationUpdate(
         info.descriptor = newDesc;
         dbSerial = saveApplication(info, txn, dbSerial);
 
-        txn.commit();
+        _groupCommit.sync(_groupCommit.commit(txn));
 
+        _applicationInstances[newDesc.name] = {info.uuid, info.revision, appHelper};
         serial = _applicationObserverTopic->applicationUpdated(dbSerial, update);
     }
     catch (const DeploymentException&)
@@ -2668,6 +2762,7 @@ Database::finishApplicationUpdate(
             {
                 lock_guard lock(_mutex);
                 entries.clear();
+                _applicationInstances.erase(newDesc.name);
                 ApplicationHelper previous(_communicator, newDesc);
                 ApplicationHelper helper(_communicator, oldApp.descriptor);
 
@@ -2678,7 +2773,7 @@ Database::finishApplicationUpdate(
                 {
                     IceDB::ReadWriteTxn txn(_env);
                     dbSerial = saveApplication(info, txn);
-                    txn.commit();
+                    _groupCommit.sync(_groupCommit.commit(txn));
                 }
                 catch (const IceDB::LMDBException& ex)
                 {
@@ -2750,6 +2845,29 @@ Database::finishUpdating(const string& name)
     _condVar.notify_all();
 }
 
+void
+Database::queueNotification(uint64_t commit, function<void()> notify)
+{
+    // Must be called within the synchronization, with the commit number of the last committed transaction.
+    lock_guard lock(_notificationsMutex);
+    assert(_notifications.empty() || _notifications.back().first < commit);
+    _notifications.emplace_back(commit, std::move(notify));
+}
+
+void
+Database::runNotifications(uint64_t synced)
+{
+    // The notifications run with the mutex locked: they're sent in commit order, and the notification of the caller
+    // is sent once this returns, even if it's sent by another thread.
+    lock_guard lock(_notificationsMutex);
+    while (!_notifications.empty() && _notifications.front().first <= synced)
+    {
+        auto notify = std::move(_notifications.front().second);
+        _notifications.pop_front();
+        notify();
+    }
+}
+
 int64_t
 Database::getSerial(const IceDB::Txn& txn, const string& dbName)
 {
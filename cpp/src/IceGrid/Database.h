@@ -17,6 +17,9 @@
 #include "ServerCache.h"
 #include "Topics.h"
 
+#include <deque>
+#include <functional>
+
 namespace IceGrid
 {
     class AdminSessionI;
@@ -194,12 +197,14 @@ namespace IceGrid
         void finishApplicationUpdate(
             const ApplicationUpdateInfo&,
             const ApplicationInfo&,
-            const ApplicationHelper&,
-            const ApplicationHelper&,
+            const std::shared_ptr<const ApplicationHelper>&,
+            const std::shared_ptr<const ApplicationHelper>&,
             AdminSessionI*,
             bool,
             std::int64_t = 0);
 
+        std::shared_ptr<const ApplicationHelper> getApplicationHelper(const ApplicationInfo&);
+
         void checkSessionLock(AdminSessionI*);
 
         void waitForUpdate(std::unique_lock<std::mutex>&, const std::string&);
@@ -215,6 +220,9 @@ namespace IceGrid
         void addObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
         void deleteObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
 
+        void queueNotification(std::uint64_t, std::function<void()>);
+        void runNotifications(std::uint64_t);
+
         friend struct AddComponent;
 
         const Ice::CommunicatorPtr _communicator;
@@ -241,6 +249,15 @@ namespace IceGrid
         IceInternal::FileLock _dbLock;
         IceDB::Env _env;
 
+        // Groups the disk flushes of the concurrent updates: the adapter and object updates commit with the database
+        // locked and wait for the flush once the database is unlocked.
+        IceDB::GroupCommit _groupCommit;
+
+        // The observer notifications of the updates waiting for their flush, in commit order. An update is only
+        // notified to the observers and replicas once it's flushed.
+        std::mutex _notificationsMutex;
+        std::deque<std::pair<std::uint64_t, std::function<void()>>> _notifications;
+
         StringApplicationInfoMap _applications;
 
         StringAdapterInfoMap _adapters;
@@ -259,6 +276,17 @@ namespace IceGrid
         AdminSessionI* _lock{nullptr};
         std::string _lockUserId;
 
+        // The instance of the current revision of each application. It's kept to not instantiate the current
+        // descriptor again on each update of the application, and to only instantiate the updated parts of the new
+        // descriptor.
+        struct ApplicationInstance
+        {
+            std::string uuid;
+            int revision;
+            std::shared_ptr<const ApplicationHelper> helper;
+        };
+        std::map<std::string, ApplicationInstance> _applicationInstances;
+
         struct UpdateInfo
         {
             std::string name;
@@ -2007,7 +2007,12 @@ ServerInstanceHelper::getReplicaGroups(set<string>& replicaGroups) const
     _serverInstance->getReplicaGroups(replicaGroups);
 }
 
-NodeHelper::NodeHelper(string name, NodeDescriptor descriptor, const Resolver& appResolve, bool instantiate)
+NodeHelper::NodeHelper(
+    string name,
+    NodeDescriptor descriptor,
+    const Resolver& appResolve,
+    bool instantiate,
+    const NodeHelper* previous)
     : _name(std::move(name)),
       _def(std::move(descriptor))
 {
@@ -2038,9 +2043,23 @@ NodeHelper::NodeHelper(string name, NodeDescriptor descriptor, const Resolver& a
         resolve.addPropertySets(_instance.propertySets);
     }
 
+    //
+    // If the node variables and property sets didn't change, the servers of the previous node instance whose
+    // definition didn't change are not instantiated again. We only resolve the server ID to look them up.
+    //
+    const bool reuse = instantiate && previous && _def.variables == previous->_def.variables &&
+                       _def.propertySets == previous->_def.propertySets;
+
     for (const auto& serverInstance : _def.serverInstances)
     {
-        ServerInstanceHelper helper(serverInstance, resolve, instantiate);
+        ServerInstanceHelper helper(serverInstance, resolve, instantiate && !reuse);
+        if (reuse)
+        {
+            auto p = previous->_serverInstances.find(helper.getId());
+            helper = p != previous->_serverInstances.end() && p->second == helper
+                         ? p->second
+                         : ServerInstanceHelper(serverInstance, resolve, true);
+        }
         if (!_serverInstances.insert(make_pair(helper.getId(), helper)).second)
         {
             resolve.exception("duplicate server '" + helper.getId() + "' in node '" + _name + "'");
@@ -2053,7 +2072,14 @@ NodeHelper::NodeHelper(string name, NodeDescriptor descriptor, const Resolver& a
 
     for (const auto& server : _def.servers)
     {
-        ServerInstanceHelper helper(server, resolve, instantiate);
+        ServerInstanceHelper helper(server, resolve, instantiate && !reuse);
+        if (reuse)
+        {
+            auto p = previous->_servers.find(helper.getId());
+            helper = p != previous->_servers.end() && p->second == helper
+                         ? p->second
+                         : ServerInstanceHelper(server, resolve, true);
+        }
         if (!_servers.insert(make_pair(helper.getId(), helper)).second)
         {
             resolve.exception("duplicate server '" + helper.getId() + "' in node '" + _name + "'");
@@ -2455,7 +2481,8 @@ ApplicationHelper::ApplicationHelper(
     const shared_ptr<Ice::Communicator>& communicator,
     ApplicationDescriptor appDesc,
     bool enableWarning,
-    bool instantiate)
+    bool instantiate,
+    const ApplicationHelper* previous)
     : _communicator(communicator),
       _def(std::move(appDesc))
 {
@@ -2506,9 +2533,10 @@ ApplicationHelper::ApplicationHelper(
             if (al)
             {
                 al->loadSample = resolve(al->loadSample, "replica group load sample");
-                if (al->loadSample != "" && al->loadSample != "1" && al->loadSample != "5" && al->loadSample != "15")
+                if (al->loadSample != "" && al->loadSample != "1" && al->loadSample != "5" && al->loadSample != "15" &&
+                    al->loadSample != "live")
                 {
-                    resolve.exception("invalid load sample value (allowed values are 1, 5 or 15)");
+                    resolve.exception("invalid load sample value (allowed values are 1, 5, 15 or live)");
                 }
             }
             _instance.replicaGroups.push_back(desc);
@@ -2522,13 +2550,39 @@ ApplicationHelper::ApplicationHelper(
         resolve.addPropertySets(_instance.propertySets);
     }
 
+    //
+    // If the previous instance of the application is provided and the application variables, property sets and
+    // templates didn't change, the nodes whose definition didn't change are not instantiated again, and the other
+    // nodes only instantiate the servers whose definition changed. Templates and server descriptors are compared by
+    // reference: they are shared with the previous definition when an update doesn't change them.
+    //
+    const bool reuse = instantiate && previous && !previous->_instance.name.empty() &&
+                       _def.variables == previous->_def.variables && _def.propertySets == previous->_def.propertySets &&
+                       _def.serverTemplates == previous->_def.serverTemplates &&
+                       _def.serviceTemplates == previous->_def.serviceTemplates;
+
     //
     // Create the node helpers.
     //
     NodeHelperDict::const_iterator n;
     for (const auto& node : _def.nodes)
     {
-        n = _nodes.insert(make_pair(node.first, NodeHelper(node.first, node.second, resolve, instantiate))).first;
+        const NodeHelper* previousNode = nullptr;
+        if (reuse)
+        {
+            auto p = previous->_nodes.find(node.first);
+            previousNode = p != previous->_nodes.end() ? &p->second : nullptr;
+        }
+
+        if (previousNode && node.second == previousNode->getDefinition())
+        {
+            n = _nodes.insert(make_pair(node.first, *previousNode)).first;
+        }
+        else
+        {
+            NodeHelper helper(node.first, node.second, resolve, instantiate, previousNode);
+            n = _nodes.insert(make_pair(node.first, std::move(helper))).first;
+        }
         if (instantiate)
         {
             _instance.nodes.insert(make_pair(n->first, n->second.getInstance()));
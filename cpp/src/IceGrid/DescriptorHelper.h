@@ -247,7 +247,7 @@ namespace IceGrid
     class NodeHelper final
     {
     public:
-        NodeHelper(std::string, NodeDescriptor, const Resolver&, bool);
+        NodeHelper(std::string, NodeDescriptor, const Resolver&, bool, const NodeHelper* = nullptr);
 
         bool operator==(const NodeHelper&) const;
         bool operator!=(const NodeHelper&) const;
@@ -276,7 +276,12 @@ namespace IceGrid
     class ApplicationHelper final
     {
     public:
-        ApplicationHelper(const Ice::CommunicatorPtr&, ApplicationDescriptor, bool = false, bool = true);
+        ApplicationHelper(
+            const Ice::CommunicatorPtr&,
+            ApplicationDescriptor,
+            bool = false,
+            bool = true,
+            const ApplicationHelper* = nullptr);
 
         [[nodiscard]] ApplicationUpdateDescriptor diff(const ApplicationHelper&) const;
         [[nodiscard]] ApplicationDescriptor update(const ApplicationUpdateDescriptor&) const;
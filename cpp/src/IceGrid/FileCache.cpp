@@ -6,12 +6,82 @@
 #include "Ice/Properties.h"
 #include "IceGrid/Admin.h"
 
-#include <deque>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <functional>
 
 using namespace std;
 using namespace IceGrid;
 
+namespace
+{
+    // The number of lines between two offsets of a line index.
+    const int64_t indexInterval = 64;
+
+    // The maximum number of files with a line index.
+    const size_t maxIndexedFiles = 64;
+
+    // The size of the blocks read to scan a file for newlines.
+    const int64_t blockSize = 64 * 1024;
+
+    // The number of bytes compared to check that the indexed content of a file didn't change.
+    const int64_t tailSize = 256;
+
+    string readTail(ifstream& is, int64_t end)
+    {
+        string tail(static_cast<size_t>(min(tailSize, end)), '\0');
+        is.clear();
+        is.seekg(end - static_cast<int64_t>(tail.size()));
+        is.read(tail.data(), static_cast<streamsize>(tail.size()));
+        tail.resize(static_cast<size_t>(max(is.gcount(), streamsize(0))));
+        return tail;
+    }
+
+    ifstream openFile(const string& file)
+    {
+        ifstream is(IceInternal::streamFilename(file).c_str(), ios::binary); // file is a UTF-8 string
+        if (is.fail())
+        {
+            throw FileNotAvailableException("failed to open file '" + file + "'");
+        }
+        return is;
+    }
+
+    //
+    // Calls the function with the offset following each newline found between the given offsets, until the function
+    // returns false.
+    //
+    void scanLines(ifstream& is, int64_t begin, int64_t end, const function<bool(int64_t)>& callback)
+    {
+        vector<char> block(static_cast<size_t>(min(blockSize, end - begin)));
+        is.clear();
+        is.seekg(begin);
+        int64_t pos = begin;
+        while (pos < end)
+        {
+            is.read(block.data(), static_cast<streamsize>(min(static_cast<int64_t>(block.size()), end - pos)));
+            const streamsize count = is.gcount();
+            if (count <= 0)
+            {
+                break;
+            }
+
+            const char* p = block.data();
+            const char* last = p + count;
+            while ((p = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(last - p)))) != nullptr)
+            {
+                ++p;
+                if (!callback(pos + (p - block.data())))
+                {
+                    return;
+                }
+            }
+            pos += count;
+        }
+    }
+}
+
 FileCache::FileCache(const shared_ptr<Ice::Communicator>& com)
     : _messageSizeMax(com->getProperties()->getIcePropertyAsInt("Ice.MessageSizeMax") * 1024 - 256)
 {
@@ -20,11 +90,7 @@ FileCache::FileCache(const shared_ptr<Ice::Communicator>& com)
 int64_t
 FileCache::getOffsetFromEnd(const string& file, int originalCount)
 {
-    ifstream is(IceInternal::streamFilename(file).c_str()); // file is a UTF-8 string
-    if (is.fail())
-    {
-        throw FileNotAvailableException("failed to open file '" + file + "'");
-    }
+    ifstream is = openFile(file);
 
     if (originalCount < 0)
     {
@@ -32,88 +98,120 @@ FileCache::getOffsetFromEnd(const string& file, int originalCount)
     }
 
     is.seekg(0, ios::end);
-    streampos endOfFile = is.tellg();
+    const int64_t endOfFile = is.tellg();
     if (originalCount == 0)
     {
         return endOfFile;
     }
 
-    streamoff blockSize = 16 * 1024; // Start reading a block of 16K from the end of the file.
-    streampos lastBlockOffset = endOfFile;
-    int totalCount = 0;
-    string line;
-    deque<pair<streampos, string>> lines;
-    do
-    {
-        lines.clear();
+    IceInternal::structstat buf;
+    const uint64_t fileId = IceInternal::stat(file, &buf) == 0 ? static_cast<uint64_t>(buf.st_ino) : 0;
 
-        //
-        // Move the current position of the stream to the new block to
-        // read.
-        //
-        is.clear();
-        if (lastBlockOffset - blockSize > streamoff(0))
+    shared_ptr<IndexedFile> indexedFile;
+    {
+        lock_guard lock(_mutex);
+        auto p = _indexes.find(file);
+        if (p != _indexes.end())
         {
-            is.seekg(lastBlockOffset - blockSize);
-            getline(is, line); // Ignore the first line as it's most likely not complete.
+            _indexedFiles.splice(_indexedFiles.begin(), _indexedFiles, p->second);
         }
         else
         {
-            is.seekg(0, ios::beg); // We've reached the beginning of the file.
-        }
-
-        //
-        // Read the block and count the number of lines in the block
-        // If we found the "first last N lines", we start throwing out
-        // the lines read at the beginning of the file.
-        //
-        int count = originalCount - totalCount; // Number of lines left to find.
-        while (is.good() && is.tellg() <= streamoff(lastBlockOffset))
-        {
-            streampos beg = is.tellg();
-            getline(is, line);
-            if (is.eof() && line.empty()) // Don't count the last line if it's empty.
+            // Evict the least recently used index. A request still using it keeps it alive.
+            if (_indexes.size() >= maxIndexedFiles)
             {
-                continue;
+                _indexes.erase(_indexedFiles.back().first);
+                _indexedFiles.pop_back();
             }
+            _indexedFiles.emplace_front(file, make_shared<IndexedFile>());
+            _indexes.emplace(file, _indexedFiles.begin());
+        }
+        indexedFile = _indexedFiles.front().second;
+    }
+
+    lock_guard lock(indexedFile->mutex);
+    LineIndex& index = indexedFile->index;
 
-            lines.emplace_back(beg, line);
-            ++totalCount;
-            if (lines.size() == static_cast<unsigned int>(count + 1))
+    //
+    // Rebuild the index if the file was replaced or truncated, or if its indexed content changed.
+    //
+    if (index.fileId != fileId || endOfFile < index.size || readTail(is, index.size) != index.tail)
+    {
+        index = LineIndex{};
+        index.fileId = fileId;
+    }
+
+    //
+    // Index the lines appended since the last request. A line starts at the beginning of the file and after each
+    // newline, except for the newline ending the file: the line following it is indexed once the file grows.
+    //
+    if (index.size < endOfFile)
+    {
+        auto addLine = [&index](int64_t offset)
+        {
+            if (index.lineCount % indexInterval == 0)
             {
-                --totalCount;
-                lines.pop_front();
+                index.offsets.push_back(offset);
             }
-        }
+            ++index.lineCount;
+        };
 
-        if (lastBlockOffset - blockSize < streamoff(0))
+        if (index.tail.empty() || index.tail.back() == '\n')
         {
-            break; // We're done if the block started at the beginning of the file.
+            addLine(index.size);
         }
-        else if (totalCount < originalCount)
+
+        scanLines(
+            is,
+            index.size,
+            endOfFile,
+            [&addLine, endOfFile](int64_t offset)
+            {
+                if (offset < endOfFile)
+                {
+                    addLine(offset);
+                }
+                return true;
+            });
+
+        if (is.bad())
         {
-            //
-            // Otherwise, if we still didn't find the required number of lines,
-            // read another block of text before this block.
-            //
-            lastBlockOffset -= blockSize; // Position of the block we just read.
-            blockSize *= 2;               // Read a bigger block.
+            index = LineIndex{};
+            throw FileNotAvailableException("unrecoverable error occurred while reading file '" + file + "'");
         }
-    } while (totalCount < originalCount && !is.bad());
+        index.size = endOfFile;
+        index.tail = readTail(is, endOfFile);
+    }
 
-    if (is.bad())
+    //
+    // Find the offset of the first of the last originalCount lines, from the closest indexed line.
+    //
+    const int64_t line = index.lineCount - originalCount;
+    if (line <= 0)
     {
-        throw FileNotAvailableException("unrecoverable error occurred while reading file '" + file + "'");
+        return 0;
     }
 
-    if (lines.empty())
+    int64_t offset = index.offsets[static_cast<size_t>(line / indexInterval)];
+    int64_t skip = line % indexInterval;
+    if (skip > 0)
     {
-        return 0;
+        scanLines(
+            is,
+            offset,
+            index.size,
+            [&offset, &skip](int64_t next)
+            {
+                offset = next;
+                return --skip > 0;
+            });
     }
-    else
+
+    if (is.bad())
     {
-        return lines[0].first;
+        throw FileNotAvailableException("unrecoverable error occurred while reading file '" + file + "'");
     }
+    return offset;
 }
 
 bool
@@ -131,11 +229,7 @@ FileCache::read(const string& file, int64_t offset, int size, int64_t& newOffset
         throw FileNotAvailableException("maximum bytes per read request is too low");
     }
 
-    ifstream is(IceInternal::streamFilename(file).c_str()); // file is a UTF-8 string
-    if (is.fail())
-    {
-        throw FileNotAvailableException("failed to open file '" + file + "'");
-    }
+    ifstream is = openFile(file);
 
     //
     // Check if the requested offset is past the end of the file, if
@@ -143,25 +237,44 @@ FileCache::read(const string& file, int64_t offset, int size, int64_t& newOffset
     // the EOF.
     //
     is.seekg(0, ios::end);
-    if (offset >= is.tellg())
+    const int64_t endOfFile = is.tellg();
+    if (offset >= endOfFile)
     {
-        newOffset = is.tellg();
+        newOffset = endOfFile;
         lines = Ice::StringSeq();
         return true;
     }
 
     //
-    // Read lines from the file until we read enough or reached EOF.
+    // Read the bytes which can be returned with a single read: a line which doesn't end in this block is larger than
+    // the size limit and is returned partially.
+    //
+    vector<char> block(static_cast<size_t>(min(static_cast<int64_t>(size), endOfFile - offset)));
+    is.seekg(static_cast<streamoff>(offset), ios::beg);
+    is.read(block.data(), static_cast<streamsize>(block.size()));
+    if (is.bad())
+    {
+        throw FileNotAvailableException("unrecoverable error occurred while reading file '" + file + "'");
+    }
+
+    //
+    // Split the block in lines until we read enough or reached EOF.
     //
     newOffset = offset;
     lines = Ice::StringSeq();
-    is.seekg(static_cast<streamoff>(offset), ios::beg);
     int totalSize = 0;
-    string line;
-
-    while (is.good())
+    const char* p = block.data();
+    const char* last = p + is.gcount();
+    while (true)
     {
-        getline(is, line);
+        const auto* newline = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(last - p)));
+        string line(p, newline ? newline : last);
+#ifdef _WIN32
+        if (newline && !line.empty() && line.back() == '\r')
+        {
+            line.pop_back(); // Like getline with a text mode stream.
+        }
+#endif
 
         int lineSize = static_cast<int>(line.size()) + 5; // 5 bytes for the encoding of the string size (worst case)
         if (lineSize + totalSize > size)
@@ -181,27 +294,19 @@ FileCache::read(const string& file, int64_t offset, int size, int64_t& newOffset
         }
 
         totalSize += lineSize;
-        lines.push_back(line);
 
         //
-        // If there was a partial read update the offset using the current line size,
-        // otherwise we have read a new complete line and we can use tellg to update
-        // the offset.
+        // A line without a newline ends the file: the lines larger than the block exceed the size limit above.
         //
-        if (!is.good())
-        {
-            newOffset += line.size();
-        }
-        else
+        if (!newline)
         {
-            newOffset = is.tellg();
+            newOffset += static_cast<int64_t>(line.size());
+            lines.push_back(std::move(line));
+            return true;
         }
-    }
 
-    if (is.bad())
-    {
-        throw FileNotAvailableException("unrecoverable error occurred while reading file '" + file + "'");
+        lines.push_back(std::move(line));
+        p = newline + 1;
+        newOffset = offset + (p - block.data());
     }
-
-    return is.eof();
 }
@@ -6,6 +6,12 @@
 #include "Ice/BuiltinSequences.h"
 #include "Ice/CommunicatorF.h"
 
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace IceGrid
 {
     class FileCache
@@ -17,7 +23,31 @@ namespace IceGrid
         bool read(const std::string&, std::int64_t, int, std::int64_t&, Ice::StringSeq&);
 
     private:
+        // The line index of a file. The index is extended with the lines appended since the previous request, and
+        // rebuilt if the file was truncated or replaced, for example by a log rotation.
+        struct LineIndex
+        {
+            std::uint64_t fileId{0};
+            std::int64_t size{0};
+            std::string tail; // The last indexed bytes, to check that the indexed content didn't change.
+            std::int64_t lineCount{0};
+            std::vector<std::int64_t> offsets; // The offset of one line every indexInterval lines.
+        };
+
+        // The index of a file is built and used with its own mutex locked: indexing a large file doesn't block the
+        // requests for the other files.
+        struct IndexedFile
+        {
+            std::mutex mutex;
+            LineIndex index;
+        };
+        using IndexedFileList = std::list<std::pair<std::string, std::shared_ptr<IndexedFile>>>;
+
         const int _messageSizeMax;
+
+        std::mutex _mutex;
+        IndexedFileList _indexedFiles; // The most recently used first.
+        std::map<std::string, IndexedFileList::iterator> _indexes;
     };
 
 };
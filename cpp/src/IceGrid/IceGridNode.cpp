@@ -270,7 +270,8 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     // Create the activator.
     //
     auto traceLevels = make_shared<TraceLevels>(communicator(), "IceGrid.Node");
-    _activator = make_shared<Activator>(traceLevels);
+    _activator =
+        make_shared<Activator>(traceLevels, properties->getIcePropertyAsInt("IceGrid.Node.ConcurrentActivations"));
 
     //
     // Collocate the IceGrid registry if we need to.
@@ -437,6 +438,11 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     //
     _node->getPlatformInfo().start();
 
+    //
+    // Start sampling the live load of the server adapters if enabled.
+    //
+    _node->startLiveLoadSampling();
+
     // Ensures that the IceGrid registry is reachable.
     auto locator = communicator()->getDefaultLocator();
 
@@ -667,6 +667,41 @@ namespace
         const Ice::Current _current;
     };
 
+    //
+    // Collects the responses of the adapters resolved for a findAdaptersByIds request, and sends the response once
+    // all the adapters are resolved.
+    //
+    class FindAdaptersByIdsCallback final
+    {
+    public:
+        FindAdaptersByIdsCallback(size_t count, function<void(const Ice::ObjectProxySeq&)> response)
+            : _response(std::move(response)),
+              _proxies(count),
+              _pending(count)
+        {
+        }
+
+        void response(size_t index, const optional<Ice::ObjectPrx>& proxy)
+        {
+            {
+                lock_guard lock(_mutex);
+                assert(_pending > 0);
+                _proxies[index] = proxy;
+                if (--_pending > 0)
+                {
+                    return;
+                }
+            }
+            _response(_proxies);
+        }
+
+    private:
+        const function<void(const Ice::ObjectProxySeq&)> _response;
+        Ice::ObjectProxySeq _proxies;
+        size_t _pending;
+        mutex _mutex;
+    };
+
 };
 
 LocatorI::LocatorI(
@@ -824,6 +859,69 @@ LocatorI::getLocalQueryAsync(
     response(_localQuery);
 }
 
+//
+// Find several adapters with a single request. Each adapter is resolved
+// as with findAdapterById, the adapters which can't be resolved have a
+// null proxy.
+//
+void
+LocatorI::findAdaptersByIdsAsync(
+    Ice::StringSeq ids,
+    function<void(const Ice::ObjectProxySeq&)> response,
+    function<void(exception_ptr)>,
+    const Ice::Current& current) const
+{
+    if (ids.empty())
+    {
+        response({});
+        return;
+    }
+
+    auto callback = make_shared<FindAdaptersByIdsCallback>(ids.size(), std::move(response));
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        try
+        {
+            findAdapterByIdAsync(
+                ids[i],
+                [callback, i](const optional<Ice::ObjectPrx>& proxy) { callback->response(i, proxy); },
+                [callback, i](exception_ptr) { callback->response(i, nullopt); },
+                current);
+        }
+        catch (const Ice::Exception&)
+        {
+            callback->response(i, nullopt);
+        }
+    }
+}
+
+//
+// Find several objects with a single request. The objects which are not
+// registered have a null proxy.
+//
+void
+LocatorI::findObjectsByIdsAsync(
+    Ice::IdentitySeq ids,
+    function<void(const Ice::ObjectProxySeq&)> response,
+    function<void(exception_ptr)>,
+    const Ice::Current&) const
+{
+    Ice::ObjectProxySeq proxies;
+    proxies.reserve(ids.size());
+    for (const auto& id : ids)
+    {
+        try
+        {
+            proxies.emplace_back(_database->getObjectProxy(id));
+        }
+        catch (const ObjectNotRegisteredException&)
+        {
+            proxies.emplace_back(nullopt);
+        }
+    }
+    response(proxies);
+}
+
 const shared_ptr<Ice::Communicator>&
 LocatorI::getCommunicator() const
 {
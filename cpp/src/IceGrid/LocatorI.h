@@ -64,6 +64,18 @@ namespace IceGrid
             std::function<void(std::exception_ptr)>,
             const Ice::Current&) const override;
 
+        void findAdaptersByIdsAsync(
+            Ice::StringSeq,
+            std::function<void(const Ice::ObjectProxySeq&)>,
+            std::function<void(std::exception_ptr)>,
+            const Ice::Current&) const override;
+
+        void findObjectsByIdsAsync(
+            Ice::IdentitySeq,
+            std::function<void(const Ice::ObjectProxySeq&)>,
+            std::function<void(std::exception_ptr)>,
+            const Ice::Current&) const override;
+
         [[nodiscard]] const Ice::CommunicatorPtr& getCommunicator() const;
         [[nodiscard]] const std::shared_ptr<TraceLevels>& getTraceLevels() const;
 
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "NodeCache.h"
+#include "AdapterCache.h"
 #include "DescriptorHelper.h"
 #include "Ice/Communicator.h"
 #include "Ice/LoggerUtil.h"
@@ -35,10 +36,15 @@ namespace
     }
 }
 
-NodeCache::NodeCache(const shared_ptr<Ice::Communicator>& communicator, ReplicaCache& replicaCache, string replicaName)
+NodeCache::NodeCache(
+    const shared_ptr<Ice::Communicator>& communicator,
+    ReplicaCache& replicaCache,
+    AdapterCache& adapterCache,
+    string replicaName)
     : _communicator(communicator),
       _replicaName(std::move(replicaName)),
-      _replicaCache(replicaCache)
+      _replicaCache(replicaCache),
+      _adapterCache(adapterCache)
 {
 }
 
@@ -822,7 +828,7 @@ NodeEntry::getInternalServerDescriptor(const ServerInfo& info) const
     //
     forEachCommunicator(
         info.descriptor,
-        [server, node = _session->getInfo(), iceVersion](const auto& desc)
+        [server, node = _session->getInfo(), iceVersion, &adapterCache = _cache.getAdapterCache()](const auto& desc)
         {
             //
             // Figure out the configuration file name for the communicator
@@ -862,9 +868,18 @@ NodeEntry::getInternalServerDescriptor(const ServerInfo& info) const
             //
             for (const auto& adapter : desc->adapters)
             {
+                // The node only samples the live load of the adapters of the server communicator.
+                optional<bool> liveLoad;
+                if (!svc && !adapter.replicaGroupId.empty() &&
+                    adapterCache.isLiveLoadReplicaGroup(adapter.replicaGroupId))
+                {
+                    liveLoad = true;
+                }
+
                 server->adapters.push_back(make_shared<InternalAdapterDescriptor>(
                     adapter.id,
-                    ignoreServerLifetime ? false : adapter.serverLifetime));
+                    ignoreServerLifetime ? false : adapter.serverLifetime,
+                    liveLoad));
 
                 serverProps.push_back(createProperty("# Object adapter " + adapter.name));
 
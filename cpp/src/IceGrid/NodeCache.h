@@ -8,6 +8,7 @@
 
 namespace IceGrid
 {
+    class AdapterCache;
     class NodeCache;
     class NodeSessionI;
     class ReplicaCache;
@@ -86,18 +87,20 @@ namespace IceGrid
     public:
         using ValueType = NodeEntry*;
 
-        NodeCache(const Ice::CommunicatorPtr&, ReplicaCache&, std::string);
+        NodeCache(const Ice::CommunicatorPtr&, ReplicaCache&, AdapterCache&, std::string);
 
         [[nodiscard]] std::shared_ptr<NodeEntry> get(const std::string&, bool = false) const;
 
         [[nodiscard]] const Ice::CommunicatorPtr& getCommunicator() const { return _communicator; }
         [[nodiscard]] const std::string& getReplicaName() const { return _replicaName; }
         [[nodiscard]] ReplicaCache& getReplicaCache() const { return _replicaCache; }
+        [[nodiscard]] AdapterCache& getAdapterCache() const { return _adapterCache; }
 
     private:
         const Ice::CommunicatorPtr _communicator;
         const std::string _replicaName;
         ReplicaCache& _replicaCache;
+        AdapterCache& _adapterCache;
     };
 
 };
@@ -14,6 +14,45 @@
 using namespace std;
 using namespace IceGrid;
 
+namespace
+{
+    // Collects the adapter loads of the servers sampled by a sampling round, and sends them to the registries once
+    // all the servers replied or failed.
+    class AdapterLoadCollector final
+    {
+    public:
+        AdapterLoadCollector(function<void(const AdapterLoadSeq&)> send, size_t count)
+            : _send(std::move(send)),
+              _count(count)
+        {
+        }
+
+        void add(const AdapterLoadSeq& loads)
+        {
+            AdapterLoadSeq all;
+            {
+                lock_guard lock(_mutex);
+                _loads.insert(_loads.end(), loads.begin(), loads.end());
+                assert(_count > 0);
+                if (--_count > 0)
+                {
+                    return;
+                }
+                all = std::move(_loads);
+            }
+            _send(all);
+        }
+
+    private:
+        const function<void(const AdapterLoadSeq&)> _send;
+        size_t _count;
+        AdapterLoadSeq _loads;
+        mutex _mutex;
+    };
+}
+
+const string NodeI::liveLoadView = "IceGridLiveLoad";
+
 NodeI::Update::Update(
     UpdateFunction updateFunction,
     const shared_ptr<NodeI>& node,
@@ -77,6 +116,8 @@ NodeI::NodeI(
         chrono::seconds(props->getIcePropertyAsInt("IceGrid.Node.DisableOnFailure"));
     const_cast<bool&>(_allowRunningServersAsRoot) =
         props->getIcePropertyAsInt("IceGrid.Node.AllowRunningServersAsRoot") > 0;
+    const_cast<chrono::milliseconds&>(_liveLoadPeriod) =
+        chrono::milliseconds(max(props->getIcePropertyAsInt("IceGrid.Node.LiveLoadPeriod"), 0));
 
     //
     // Parse the properties override property.
@@ -246,6 +287,15 @@ NodeI::read(string filename, int64_t pos, int size, int64_t& newPos, Ice::String
 void
 NodeI::shutdown()
 {
+    {
+        lock_guard lock(_liveLoadMutex);
+        if (_liveLoadTask)
+        {
+            _timer->cancel(_liveLoadTask);
+            _liveLoadTask = nullptr;
+        }
+    }
+
     lock_guard lock(_serversMutex);
     for (const auto& servers : _serversByApplication)
     {
@@ -257,6 +307,27 @@ NodeI::shutdown()
     _serversByApplication.clear();
 }
 
+void
+NodeI::startLiveLoadSampling()
+{
+    if (_liveLoadPeriod == 0ms)
+    {
+        return;
+    }
+
+    lock_guard lock(_liveLoadMutex);
+    weak_ptr<NodeI> self = shared_from_this();
+    _liveLoadTask = make_shared<IceInternal::InlineTimerTask>(
+        [self]
+        {
+            if (auto node = self.lock())
+            {
+                node->sampleAdapterLoads();
+            }
+        });
+    _timer->scheduleRepeated(_liveLoadTask, _liveLoadPeriod);
+}
+
 shared_ptr<Ice::Communicator>
 NodeI::getCommunicator() const
 {
@@ -347,6 +418,12 @@ NodeI::getDisableOnFailure() const
     return _disableOnFailure;
 }
 
+chrono::milliseconds
+NodeI::getLiveLoadPeriod() const
+{
+    return _liveLoadPeriod;
+}
+
 bool
 NodeI::allowRunningServersAsRoot() const
 {
@@ -793,6 +870,154 @@ NodeI::getFilePath(const string& filename) const
     return file;
 }
 
+void
+NodeI::sampleAdapterLoads()
+{
+    {
+        lock_guard lock(_observerMutex);
+        if (_observers.empty())
+        {
+            return; // No registry to report the loads to.
+        }
+    }
+
+    vector<shared_ptr<ServerI>> servers;
+    {
+        lock_guard lock(_serversMutex);
+        for (const auto& [application, applicationServers] : _serversByApplication)
+        {
+            servers.insert(servers.end(), applicationServers.begin(), applicationServers.end());
+        }
+    }
+
+    // The dispatch metrics are retrieved from the Metrics facet of the admin object of the active servers. The
+    // invocation timeout ensures that an unresponsive server doesn't prevent the next sampling rounds.
+    vector<pair<IceMX::MetricsAdminPrx, map<string, string>>> sources;
+    set<string> adapterIds;
+    for (const auto& server : servers)
+    {
+        optional<Ice::ObjectPrx> process = server->getProcess();
+        map<string, string> serverAdapterIds = server->getAdapterIdsByName();
+        if (process && !serverAdapterIds.empty())
+        {
+            for (const auto& [name, id] : serverAdapterIds)
+            {
+                adapterIds.insert(id);
+            }
+            sources.emplace_back(
+                process->ice_facet<IceMX::MetricsAdminPrx>("Metrics")->ice_invocationTimeout(_liveLoadPeriod),
+                std::move(serverAdapterIds));
+        }
+    }
+
+    {
+        lock_guard lock(_liveLoadMutex);
+        if (_liveLoadSampling)
+        {
+            return; // The previous sampling round is still in progress.
+        }
+
+        // Forget the dispatches of the adapters which are no longer active.
+        for (auto p = _adapterDispatches.begin(); p != _adapterDispatches.end();)
+        {
+            p = adapterIds.find(p->first) == adapterIds.end() ? _adapterDispatches.erase(p) : next(p);
+        }
+
+        _liveLoadSampling = !sources.empty();
+    }
+
+    if (sources.empty())
+    {
+        sendAdapterLoads({});
+        return;
+    }
+
+    auto self = shared_from_this();
+    auto collector = make_shared<AdapterLoadCollector>(
+        [self](const AdapterLoadSeq& loads)
+        {
+            {
+                lock_guard lock(self->_liveLoadMutex);
+                self->_liveLoadSampling = false;
+            }
+            self->sendAdapterLoads(loads);
+        },
+        sources.size());
+
+    for (auto& source : sources)
+    {
+        try
+        {
+            source.first->getMetricsViewAsync(
+                liveLoadView,
+                [self, collector, serverAdapterIds = std::move(source.second)](IceMX::MetricsView view, int64_t)
+                { collector->add(self->computeAdapterLoads(serverAdapterIds, view)); },
+                [collector](exception_ptr) { collector->add({}); }); // The server doesn't report its live load.
+        }
+        catch (const Ice::LocalException&)
+        {
+            collector->add({});
+        }
+    }
+}
+
+AdapterLoadSeq
+NodeI::computeAdapterLoads(const map<string, string>& adapterIds, const IceMX::MetricsView& view)
+{
+    // The dispatch metrics of the view are grouped by adapter name.
+    map<string, IceMX::MetricsPtr> dispatches;
+    auto p = view.find("Dispatch");
+    if (p != view.end())
+    {
+        for (const auto& metrics : p->second)
+        {
+            if (metrics)
+            {
+                dispatches.insert({metrics->id, metrics});
+            }
+        }
+    }
+
+    AdapterLoadSeq loads;
+    lock_guard lock(_liveLoadMutex);
+    for (const auto& [name, id] : adapterIds)
+    {
+        AdapterLoad load{id, 0, -1.0f};
+        auto q = dispatches.find(name);
+        if (q != dispatches.end())
+        {
+            // A dispatch is counted in total when it starts, and its duration (in microseconds) is added to
+            // totalLifetime when it completes. The counters are reset when the server restarts.
+            const IceMX::MetricsPtr& metrics = q->second;
+            const int64_t completed = metrics->total - metrics->current;
+            auto& previous = _adapterDispatches[id];
+            if (completed > previous.first && metrics->totalLifetime >= previous.second)
+            {
+                load.latency = static_cast<float>(metrics->totalLifetime - previous.second) /
+                               static_cast<float>(completed - previous.first) / 1000.0f;
+            }
+            previous = {completed, metrics->totalLifetime};
+            load.inFlight = metrics->current;
+        }
+        loads.push_back(std::move(load));
+    }
+    return loads;
+}
+
+void
+NodeI::sendAdapterLoads(const AdapterLoadSeq& loads)
+{
+    const auto period = static_cast<int>(_liveLoadPeriod.count());
+
+    lock_guard lock(_observerMutex);
+    for (const auto& [session, observer] : _observers)
+    {
+        // Failures are ignored: older registries don't support live loads and the session keep alive takes care of
+        // detecting unreachable registries.
+        session->updateAdapterLoadsAsync(loads, period, nullptr, nullptr);
+    }
+}
+
 void
 NodeI::loadServer(
     shared_ptr<InternalServerDescriptor> descriptor, // NOLINT(performance-unnecessary-value-param)
@@ -5,6 +5,7 @@
 
 #include "../Ice/Timer.h"
 #include "FileCache.h"
+#include "Ice/Metrics.h"
 #include "IceGrid/UserAccountMapper.h"
 #include "Internal.h"
 #include "PlatformInfo.h"
@@ -38,6 +39,9 @@ namespace IceGrid
             std::optional<NodeObserverPrx> _observer;
         };
 
+        // The name of the dispatch metrics view the node samples to compute the live load of the server adapters.
+        static const std::string liveLoadView;
+
         NodeI(
             const Ice::ObjectAdapterPtr&,
             NodeSessionManager&,
@@ -98,6 +102,9 @@ namespace IceGrid
 
         void shutdown();
 
+        // Starts sampling the live load of the server adapters if IceGrid.Node.LiveLoadPeriod is set.
+        void startLiveLoadSampling();
+
         [[nodiscard]] IceInternal::TimerPtr getTimer() const;
         [[nodiscard]] Ice::CommunicatorPtr getCommunicator() const;
         [[nodiscard]] Ice::ObjectAdapterPtr getAdapter() const;
@@ -114,6 +121,7 @@ namespace IceGrid
         [[nodiscard]] bool getRedirectErrToOut() const;
         [[nodiscard]] bool allowEndpointsOverride() const;
         [[nodiscard]] std::chrono::seconds getDisableOnFailure() const;
+        [[nodiscard]] std::chrono::milliseconds getLiveLoadPeriod() const;
         [[nodiscard]] bool allowRunningServersAsRoot() const;
 
         std::optional<NodeSessionPrx> registerWithRegistry(const InternalRegistryPrx&);
@@ -141,6 +149,10 @@ namespace IceGrid
 
         [[nodiscard]] std::string getFilePath(const std::string&) const;
 
+        void sampleAdapterLoads();
+        AdapterLoadSeq computeAdapterLoads(const std::map<std::string, std::string>&, const IceMX::MetricsView&);
+        void sendAdapterLoads(const AdapterLoadSeq&);
+
         void loadServer(
             std::shared_ptr<InternalServerDescriptor>,
             std::string,
@@ -172,6 +184,7 @@ namespace IceGrid
         const bool _allowEndpointsOverride{false};
         const int _waitTime{0};
         const std::chrono::seconds _disableOnFailure{0};
+        const std::chrono::milliseconds _liveLoadPeriod{0};
         const bool _allowRunningServersAsRoot{false};
         const std::string _instanceName;
         const std::optional<UserAccountMapperPrx> _userAccountMapper;
@@ -194,6 +207,12 @@ namespace IceGrid
         mutable std::mutex _serversMutex;
         std::map<std::string, std::set<std::shared_ptr<ServerI>>> _serversByApplication;
 
+        std::mutex _liveLoadMutex;
+        IceInternal::TimerTaskPtr _liveLoadTask;
+        bool _liveLoadSampling{false};
+        // The number of completed dispatches and their total duration of each adapter, at the previous sampling.
+        std::map<std::string, std::pair<std::int64_t, std::int64_t>> _adapterDispatches;
+
         std::mutex _mutex;
         std::condition_variable _condVar;
     };
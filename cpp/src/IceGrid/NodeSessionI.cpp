@@ -95,6 +95,36 @@ NodeSessionI::keepAlive(LoadInfo load, const Ice::Current&)
     }
 }
 
+void
+NodeSessionI::updateAdapterLoads(AdapterLoadSeq loads, int period, const Ice::Current&)
+{
+    lock_guard lock(_mutex);
+
+    if (_destroy)
+    {
+        throw Ice::ObjectNotExistException{__FILE__, __LINE__};
+    }
+
+    // The loads are replaced by the next update. If the node stops sending updates, for example because sampling
+    // fails, the loads expire after a few sampling periods to not route requests based on outdated loads.
+    _adapterLoads.clear();
+    for (auto& load : loads)
+    {
+        _adapterLoads.insert({load.id, std::move(load)});
+    }
+    _adapterLoadsExpiration = chrono::steady_clock::now() + 3 * chrono::milliseconds(max(period, 0));
+
+    if (_traceLevels->node > 2)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->nodeCat);
+        out << "node '" << _info->name << "' adapter loads";
+        for (const auto& [id, load] : _adapterLoads)
+        {
+            out << "\n" << id << ": in-flight = " << load.inFlight << ", latency = " << load.latency << "ms";
+        }
+    }
+}
+
 void
 NodeSessionI::setReplicaObserver(std::optional<ReplicaObserverPrx> observer, const Ice::Current& current)
 {
@@ -221,6 +251,23 @@ NodeSessionI::getLoadInfo() const
     return _load;
 }
 
+optional<AdapterLoad>
+NodeSessionI::getAdapterLoad(const string& id) const
+{
+    lock_guard lock(_mutex);
+    if (chrono::steady_clock::now() > _adapterLoadsExpiration)
+    {
+        return nullopt;
+    }
+
+    auto p = _adapterLoads.find(id);
+    if (p == _adapterLoads.end())
+    {
+        return nullopt;
+    }
+    return p->second;
+}
+
 NodeSessionPrx
 NodeSessionI::getProxy() const
 {
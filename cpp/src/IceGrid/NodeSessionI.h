@@ -22,6 +22,7 @@ namespace IceGrid
             const LoadInfo&);
 
         void keepAlive(LoadInfo, const Ice::Current&) final;
+        void updateAdapterLoads(AdapterLoadSeq, int, const Ice::Current&) final;
         void setReplicaObserver(std::optional<ReplicaObserverPrx>, const Ice::Current&) final;
         [[nodiscard]] int getTimeout(const Ice::Current&) const final;
         [[nodiscard]] std::optional<NodeObserverPrx> getObserver(const Ice::Current&) const final;
@@ -44,6 +45,9 @@ namespace IceGrid
         [[nodiscard]] const NodePrx& getNode() const;
         [[nodiscard]] const std::shared_ptr<InternalNodeInfo>& getInfo() const noexcept;
         [[nodiscard]] LoadInfo getLoadInfo() const;
+
+        // Returns the live load of the given adapter, or nullopt if the node didn't report a recent load for it.
+        [[nodiscard]] std::optional<AdapterLoad> getAdapterLoad(const std::string&) const;
         [[nodiscard]] NodeSessionPrx getProxy() const;
 
         [[nodiscard]] bool isDestroyed() const;
@@ -71,6 +75,8 @@ namespace IceGrid
         std::optional<ReplicaObserverPrx> _replicaObserver;
         std::chrono::steady_clock::time_point _timestamp;
         LoadInfo _load;
+        std::map<std::string, AdapterLoad> _adapterLoads;
+        std::chrono::steady_clock::time_point _adapterLoadsExpiration;
         bool _destroy{false};
 
         mutable std::mutex _mutex;
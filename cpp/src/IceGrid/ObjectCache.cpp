@@ -37,7 +37,10 @@ ObjectCache::TypeEntry::remove(const shared_ptr<ObjectEntry>& obj)
     return _objects.empty();
 }
 
-ObjectCache::ObjectCache(const shared_ptr<Ice::Communicator>& communicator) : _communicator(communicator) {}
+ObjectCache::ObjectCache(const shared_ptr<Ice::Communicator>& communicator) : _communicator(communicator)
+{
+    _snapshot.store(make_shared<const Snapshot>());
+}
 
 void
 ObjectCache::add(const ObjectInfo& info, const string& application, const string& server)
@@ -61,6 +64,8 @@ ObjectCache::add(const ObjectInfo& info, const string& application, const string
         p = _types.insert(p, {entry->getType(), TypeEntry()});
     }
     p->second.add(entry);
+    _changedTypes.insert(entry->getType());
+    _changedIdentities[_communicator->identityToString(id)] = entry;
 
     if (_traceLevels && _traceLevels->object > 0)
     {
@@ -100,6 +105,8 @@ ObjectCache::remove(const Ice::Identity& id)
     {
         _types.erase(p);
     }
+    _changedTypes.insert(entry->getType());
+    _changedIdentities[_communicator->identityToString(id)] = nullptr;
 
     if (_traceLevels && _traceLevels->object > 0)
     {
@@ -108,42 +115,78 @@ ObjectCache::remove(const Ice::Identity& id)
     }
 }
 
-vector<shared_ptr<ObjectEntry>>
-ObjectCache::getObjectsByType(const string& type)
+void
+ObjectCache::publish()
 {
     lock_guard lock(_mutex);
-    auto p = _types.find(type);
-    return p == _types.end() ? vector<shared_ptr<ObjectEntry>>{} : p->second.getObjects();
+    if (_changedTypes.empty() && _changedIdentities.empty())
+    {
+        return;
+    }
+
+    auto previous = _snapshot.load();
+    auto snapshot = make_shared<Snapshot>();
+    snapshot->types = previous->types;
+    for (const auto& type : _changedTypes)
+    {
+        auto p = _types.find(type);
+        if (p == _types.end())
+        {
+            snapshot->types.erase(type);
+        }
+        else
+        {
+            snapshot->types[type] = make_shared<const vector<shared_ptr<ObjectEntry>>>(p->second.getObjects());
+        }
+    }
+    snapshot->identities = previous->identities.apply(_changedIdentities);
+    _changedTypes.clear();
+    _changedIdentities.clear();
+
+    _snapshot.store(std::move(snapshot));
+}
+
+vector<shared_ptr<ObjectEntry>>
+ObjectCache::getObjectsByType(const string& type) const
+{
+    auto snapshot = _snapshot.load();
+    auto p = snapshot->types.find(type);
+    return p == snapshot->types.end() ? vector<shared_ptr<ObjectEntry>>{} : *p->second;
 }
 
 ObjectInfoSeq
-ObjectCache::getAll(const string& expression)
+ObjectCache::getAll(const string& expression) const
 {
-    lock_guard lock(_mutex);
     ObjectInfoSeq infos;
-    for (const auto& entry : _entries)
+    auto snapshot = _snapshot.load();
+
+    //
+    // Only the identities starting with the expression characters preceding the wildcard can match.
+    //
+    const string prefix = expression.substr(0, expression.find('*'));
+    for (const auto& [identity, entry] : snapshot->identities.findPrefix(prefix))
     {
-        if (expression.empty() || IceInternal::match(_communicator->identityToString(entry.first), expression, true))
+        if (expression.empty() || IceInternal::match(identity, expression, true))
         {
-            infos.push_back(entry.second->getObjectInfo());
+            infos.push_back(entry->getObjectInfo());
         }
     }
     return infos;
 }
 
 ObjectInfoSeq
-ObjectCache::getAllByType(const string& type)
+ObjectCache::getAllByType(const string& type) const
 {
-    lock_guard lock(_mutex);
     ObjectInfoSeq infos;
-    auto p = _types.find(type);
-    if (p == _types.end())
+    auto snapshot = _snapshot.load();
+    auto p = snapshot->types.find(type);
+    if (p == snapshot->types.end())
     {
         return infos;
     }
 
-    const vector<shared_ptr<ObjectEntry>>& objects = p->second.getObjects();
-    for (const auto& object : objects)
+    infos.reserve(p->second->size());
+    for (const auto& object : *p->second)
     {
         infos.push_back(object->getObjectInfo());
     }
@@ -6,6 +6,9 @@
 #include "Cache.h"
 #include "Ice/CommunicatorF.h"
 #include "Internal.h"
+#include "Snapshot.h"
+
+#include <set>
 
 namespace IceGrid
 {
@@ -38,10 +41,15 @@ namespace IceGrid
         [[nodiscard]] std::shared_ptr<ObjectEntry> get(const Ice::Identity&) const;
         void remove(const Ice::Identity&);
 
-        std::vector<std::shared_ptr<ObjectEntry>> getObjectsByType(const std::string&);
+        // Publishes a snapshot of the current objects. The database calls this once the cache reflects a complete
+        // application update.
+        void publish();
+
+        // The queries below read the latest published snapshot, without locking the cache.
+        [[nodiscard]] std::vector<std::shared_ptr<ObjectEntry>> getObjectsByType(const std::string&) const;
 
-        ObjectInfoSeq getAll(const std::string&);
-        ObjectInfoSeq getAllByType(const std::string&);
+        [[nodiscard]] ObjectInfoSeq getAll(const std::string&) const;
+        [[nodiscard]] ObjectInfoSeq getAllByType(const std::string&) const;
 
     private:
         class TypeEntry
@@ -56,8 +64,23 @@ namespace IceGrid
             std::vector<std::shared_ptr<ObjectEntry>> _objects;
         };
 
+        // An immutable snapshot of the objects. The object lists of the types which didn't change and the identity
+        // shards without added or removed objects are shared with the previous snapshot.
+        struct Snapshot
+        {
+            std::map<std::string, std::shared_ptr<const std::vector<std::shared_ptr<ObjectEntry>>>> types;
+
+            // The objects by stringified identity: the objects matching an expression share its prefix.
+            ShardedMap<ObjectEntry> identities;
+        };
+
         const Ice::CommunicatorPtr _communicator;
         std::map<std::string, TypeEntry> _types;
+        std::set<std::string> _changedTypes;
+
+        // The objects added or removed (null) since the last publication, by stringified identity.
+        std::map<std::string, std::shared_ptr<ObjectEntry>> _changedIdentities;
+        PublishedPtr<Snapshot> _snapshot;
     };
 
 };
@@ -8,6 +8,7 @@
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
 #include "NodeCache.h"
+#include "NodeSessionI.h"
 #include "ObjectCache.h"
 #include "SessionI.h"
 #include "SynchronizationException.h"
@@ -631,6 +632,30 @@ ServerEntry::getLoad(LoadSample sample) const
     }
 }
 
+optional<AdapterLoad>
+ServerEntry::getAdapterLoad(const string& id) const
+{
+    string node;
+    {
+        lock_guard lock(_mutex);
+        if (_loaded)
+        {
+            node = _loaded->node;
+        }
+        else if (_load)
+        {
+            node = _load->node;
+        }
+        else
+        {
+            throw ServerNotExistException();
+        }
+    }
+
+    auto session = _cache.getNodeCache().get(node)->getSession();
+    return session ? session->getAdapterLoad(id) : nullopt;
+}
+
 void
 ServerEntry::syncImpl()
 {
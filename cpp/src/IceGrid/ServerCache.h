@@ -70,6 +70,7 @@ namespace IceGrid
         AdapterPrx getAdapter(const std::string&, bool);
         AdapterPrx getAdapter(std::chrono::seconds&, std::chrono::seconds&, const std::string&, bool);
         [[nodiscard]] float getLoad(LoadSample) const;
+        [[nodiscard]] std::optional<AdapterLoad> getAdapterLoad(const std::string&) const;
 
         bool canRemove();
         std::shared_ptr<CheckUpdateResult> checkUpdate(const ServerInfo&, bool);
@@ -13,6 +13,7 @@
 
 #include "../Ice/DisableWarnings.h"
 
+#include <algorithm>
 #include <fstream>
 #include <sys/types.h>
 
@@ -1010,6 +1011,45 @@ ServerI::getId() const
     return _id;
 }
 
+map<string, string>
+ServerI::getAdapterIdsByName() const
+{
+    lock_guard lock(_mutex);
+
+    map<string, string> adapterIds;
+    if (!_desc)
+    {
+        return adapterIds;
+    }
+
+    set<string> liveLoadAdapterIds;
+    for (const auto& adapter : _desc->adapters)
+    {
+        if (adapter->liveLoad.value_or(false) && _adapters.find(adapter->id) != _adapters.end())
+        {
+            liveLoadAdapterIds.insert(adapter->id);
+        }
+    }
+
+    auto p = _desc->properties.find("config");
+    if (liveLoadAdapterIds.empty() || p == _desc->properties.end())
+    {
+        return adapterIds;
+    }
+
+    const string suffix = ".AdapterId";
+    for (const auto& property : p->second)
+    {
+        if (property.name.size() > suffix.size() &&
+            property.name.compare(property.name.size() - suffix.size(), suffix.size(), suffix) == 0 &&
+            liveLoadAdapterIds.find(property.value) != liveLoadAdapterIds.end())
+        {
+            adapterIds.insert({property.name.substr(0, property.name.size() - suffix.size()), property.value});
+        }
+    }
+    return adapterIds;
+}
+
 void
 ServerI::start(ServerActivation activation, function<void()> response, function<void(exception_ptr)> exception)
 {
@@ -1434,6 +1474,24 @@ ServerI::activationTimedOut()
     }
 }
 
+void
+ServerI::activationSlotAvailable()
+{
+    {
+        lock_guard lock(_mutex);
+        if (_state == Activating && _start)
+        {
+            //
+            // Restart the activation timeout, the server waited for the activation slot in the Activating state and
+            // the activation timeout only applies to the WaitForActivation state.
+            //
+            _start->stopTimer();
+            _start->startTimer();
+        }
+    }
+    activate();
+}
+
 void
 ServerI::activate()
 {
@@ -1450,7 +1508,11 @@ ServerI::activate()
     {
         {
             lock_guard lock(_mutex);
-            assert(_state == Activating && _desc);
+            if (_state != Activating)
+            {
+                return; // The server was stopped or destroyed while it was waiting for an activation slot.
+            }
+            assert(_desc);
             desc = _desc;
             adpts = _adapters;
 
@@ -1495,6 +1557,15 @@ ServerI::activate()
             }
         }
 
+        //
+        // The node activates at most IceGrid.Node.ConcurrentActivations servers concurrently. If there's no
+        // activation slot available, activationSlotAvailable() resumes the activation once a slot is released.
+        //
+        if (!_node->getActivator()->reserveActivation(shared_from_this()))
+        {
+            return;
+        }
+
         //
         // Compute the server command line options.
         //
@@ -2641,6 +2712,26 @@ ServerI::setStateNoSync(InternalServerState st, const string& reason)
         _condVar.notify_all();
     }
 
+    //
+    // Release the activation slot once the server is active or its activation failed or timed out, and resume the
+    // activation of the servers waiting for a slot. They are resumed from the timer thread since we hold the lock.
+    //
+    auto isActivating = [](InternalServerState state) { return state == Activating || state == WaitForActivation; };
+    if (isActivating(previous) && !isActivating(_state))
+    {
+        for (const auto& server : _node->getActivator()->releaseActivation(_id))
+        {
+            try
+            {
+                _node->getTimer()->schedule([server] { server->activationSlotAvailable(); }, 0ms);
+            }
+            catch (const std::exception&)
+            {
+                // Ignore, timer is destroyed because node is shutting down.
+            }
+        }
+    }
+
     //
     // Check if some commands are done.
     //
@@ -3012,6 +3103,23 @@ ServerI::getProperties(const shared_ptr<InternalServerDescriptor>& desc)
         }
     }
 
+    //
+    // Enable the dispatch metrics view sampled by the node to report the live load of the server adapters, if one of
+    // them belongs to a replica group with the live load sample.
+    //
+    if (_node->getLiveLoadPeriod() > 0ms &&
+        any_of(
+            desc->adapters.begin(),
+            desc->adapters.end(),
+            [](const auto& adapter) { return adapter->liveLoad.value_or(false); }))
+    {
+        const string groupBy = "IceMX.Metrics." + NodeI::liveLoadView + ".Map.Dispatch.GroupBy";
+        if (!hasProperty(props, groupBy))
+        {
+            props.push_back(createProperty(groupBy, "parent"));
+        }
+    }
+
     //
     // Add the locator proxy property and the node properties override
     //
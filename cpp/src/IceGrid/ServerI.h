@@ -97,6 +97,7 @@ namespace IceGrid
         void adapterDeactivated(const std::string&);
         void activationTimedOut();
 
+        void activationSlotAvailable();
         void activate();
         void kill();
         void deactivate();
@@ -110,6 +111,10 @@ namespace IceGrid
         //
         [[nodiscard]] std::optional<Ice::ObjectPrx> getProcess() const;
 
+        // Returns the IDs of the server's adapters indexed by adapter name, for the adapters of the server's
+        // communicator which belong to a replica group with the live load sample.
+        [[nodiscard]] std::map<std::string, std::string> getAdapterIdsByName() const;
+
         PropertyDescriptorSeqDict getProperties(const std::shared_ptr<InternalServerDescriptor>&);
 
         void updateRuntimePropertiesCallback(const std::shared_ptr<InternalServerDescriptor>&);
@@ -0,0 +1,129 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICEGRID_SNAPSHOT_H
+#define ICEGRID_SNAPSHOT_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace IceGrid
+{
+    // Holds a pointer to an immutable value, replaced by a writer and read concurrently by many readers. Without
+    // std::atomic<std::shared_ptr> (C++17), the pointer is guarded by a mutex which is only held to copy it.
+    template<typename T> class PublishedPtr
+    {
+    public:
+        [[nodiscard]] std::shared_ptr<const T> load() const
+        {
+#ifdef __cpp_lib_atomic_shared_ptr
+            return _value.load();
+#else
+            std::lock_guard lock(_mutex);
+            return _value;
+#endif
+        }
+
+        void store(std::shared_ptr<const T> value)
+        {
+#ifdef __cpp_lib_atomic_shared_ptr
+            _value.store(std::move(value));
+#else
+            std::lock_guard lock(_mutex);
+            _value.swap(value);
+#endif
+        }
+
+    private:
+#ifdef __cpp_lib_atomic_shared_ptr
+        std::atomic<std::shared_ptr<const T>> _value;
+#else
+        mutable std::mutex _mutex;
+        std::shared_ptr<const T> _value;
+#endif
+    };
+
+    // An immutable map split into a fixed number of shards, by key hash. Applying changes copies only the shards
+    // with modified keys: the other shards are shared with the map the changes are applied to. This keeps the cost
+    // of publishing a small update independent of the number of entries.
+    template<typename T> class ShardedMap
+    {
+    public:
+        using Entries = std::map<std::string, std::shared_ptr<T>>;
+        using Entry = std::pair<std::string, std::shared_ptr<T>>;
+
+        ShardedMap()
+        {
+            auto empty = std::make_shared<const Entries>();
+            _shards.fill(empty);
+        }
+
+        [[nodiscard]] std::shared_ptr<T> find(const std::string& key) const
+        {
+            const auto& shard = *_shards[shardOf(key)];
+            auto p = shard.find(key);
+            return p == shard.end() ? nullptr : p->second;
+        }
+
+        // Returns the entries whose key starts with the given prefix, sorted by key.
+        [[nodiscard]] std::vector<Entry> findPrefix(const std::string& prefix) const
+        {
+            std::vector<Entry> entries;
+            for (const auto& shard : _shards)
+            {
+                for (auto p = shard->lower_bound(prefix);
+                     p != shard->end() && p->first.compare(0, prefix.size(), prefix) == 0;
+                     ++p)
+                {
+                    entries.emplace_back(*p);
+                }
+            }
+            std::sort(
+                entries.begin(),
+                entries.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            return entries;
+        }
+
+        // Returns a copy of this map with the given changes applied. A null value removes the key.
+        [[nodiscard]] ShardedMap apply(const Entries& changes) const
+        {
+            ShardedMap result(*this);
+            std::array<std::shared_ptr<Entries>, shardCount> copies;
+            for (const auto& [key, value] : changes)
+            {
+                const size_t index = shardOf(key);
+                if (!copies[index])
+                {
+                    copies[index] = std::make_shared<Entries>(*_shards[index]);
+                    result._shards[index] = copies[index];
+                }
+
+                if (value)
+                {
+                    (*copies[index])[key] = value;
+                }
+                else
+                {
+                    copies[index]->erase(key);
+                }
+            }
+            return result;
+        }
+
+    private:
+        static constexpr size_t shardCount = 64;
+
+        static size_t shardOf(const std::string& key) { return std::hash<std::string>{}(key) % shardCount; }
+
+        std::array<std::shared_ptr<const Entries>, shardCount> _shards;
+    };
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include "DescriptorHelper.h"
 #include "Ice/Ice.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace IceGrid;
 
@@ -350,18 +352,35 @@ RegistryObserverTopic::initObserver(Ice::ObjectPrx observer)
 }
 
 shared_ptr<NodeObserverTopic>
-NodeObserverTopic::create(const IceStorm::TopicManagerPrx& topicManager, const Ice::ObjectAdapterPtr& adapter)
+NodeObserverTopic::create(
+    const IceStorm::TopicManagerPrx& topicManager,
+    const Ice::ObjectAdapterPtr& adapter,
+    chrono::milliseconds updatePeriod)
 {
     Ice::Identity id{Ice::generateUUID(), ""};
-    shared_ptr<NodeObserverTopic> topic(new NodeObserverTopic(topicManager, adapter->createProxy<NodeObserverPrx>(id)));
+    shared_ptr<NodeObserverTopic> topic(
+        new NodeObserverTopic(topicManager, adapter->createProxy<NodeObserverPrx>(id), updatePeriod));
+    topic->_flushTask = make_shared<IceInternal::InlineTimerTask>(
+        [weakTopic = weak_ptr<NodeObserverTopic>(topic)]
+        {
+            if (auto self = weakTopic.lock())
+            {
+                self->flushUpdates();
+            }
+        });
     adapter->add(topic, id);
     return topic;
 }
 
-NodeObserverTopic::NodeObserverTopic(const IceStorm::TopicManagerPrx& topicManager, NodeObserverPrx externalPublisher)
+NodeObserverTopic::NodeObserverTopic(
+    const IceStorm::TopicManagerPrx& topicManager,
+    NodeObserverPrx externalPublisher,
+    chrono::milliseconds updatePeriod)
     : ObserverTopic(topicManager, "NodeObserver"),
       _externalPublisher(std::move(externalPublisher)),
-      _publishers(getPublishers<NodeObserverPrx>())
+      _publishers(getPublishers<NodeObserverPrx>()),
+      _updatePeriod(updatePeriod),
+      _timer(IceInternal::getInstanceTimer(topicManager->ice_getCommunicator()))
 {
 }
 
@@ -380,6 +399,7 @@ NodeObserverTopic::nodeUp(NodeDynamicInfo info, const Ice::Current&)
         return;
     }
     updateSerial();
+    discardUpdates(info.info.name);
     _nodes.insert({info.info.name, info});
     for (const auto& server : info.servers)
     {
@@ -457,17 +477,17 @@ NodeObserverTopic::updateServer(string node, ServerDynamicInfo server, const Ice
         _serverStatus.erase(server.id);
     }
 
-    try
+    if (_updatePeriod.count() > 0)
     {
-        for (const auto& publisher : _publishers)
+        if (_serverUpdates.insert_or_assign({node, server.id}, server).second)
         {
-            publisher->updateServer(node, server);
+            _updateOrder.emplace_back(true, make_pair(node, server.id));
         }
+        scheduleFlush();
     }
-    catch (const Ice::LocalException& ex)
+    else
     {
-        Ice::Warning out(_logger);
-        out << "unexpected exception while publishing 'updateServer' update:\n" << ex;
+        publishServer(node, server);
     }
 }
 
@@ -513,17 +533,17 @@ NodeObserverTopic::updateAdapter(string node, AdapterDynamicInfo adapter, const
         adapters.push_back(adapter);
     }
 
-    try
+    if (_updatePeriod.count() > 0)
     {
-        for (const auto& publisher : _publishers)
+        if (_adapterUpdates.insert_or_assign({node, adapter.id}, adapter).second)
         {
-            publisher->updateAdapter(node, adapter);
+            _updateOrder.emplace_back(false, make_pair(node, adapter.id));
         }
+        scheduleFlush();
     }
-    catch (const Ice::LocalException& ex)
+    else
     {
-        Ice::Warning out(_logger);
-        out << "unexpected exception while publishing 'updateAdapter' update:\n" << ex;
+        publishAdapter(node, adapter);
     }
 }
 
@@ -550,6 +570,7 @@ NodeObserverTopic::nodeDown(const string& name)
     }
 
     _nodes.erase(name);
+    discardUpdates(name);
     try
     {
         for (const auto& publisher : _publishers)
@@ -577,6 +598,102 @@ NodeObserverTopic::initObserver(Ice::ObjectPrx observer)
     nodeObserver->nodeInit(nodes, getContext(_serial));
 }
 
+void
+NodeObserverTopic::publishServer(const string& node, const ServerDynamicInfo& server)
+{
+    try
+    {
+        for (const auto& publisher : _publishers)
+        {
+            publisher->updateServer(node, server);
+        }
+    }
+    catch (const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing 'updateServer' update:\n" << ex;
+    }
+}
+
+void
+NodeObserverTopic::publishAdapter(const string& node, const AdapterDynamicInfo& adapter)
+{
+    try
+    {
+        for (const auto& publisher : _publishers)
+        {
+            publisher->updateAdapter(node, adapter);
+        }
+    }
+    catch (const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing 'updateAdapter' update:\n" << ex;
+    }
+}
+
+void
+NodeObserverTopic::scheduleFlush()
+{
+    // Must be called with the lock held.
+    if (!_flushScheduled)
+    {
+        _timer->schedule(_flushTask, _updatePeriod);
+        _flushScheduled = true;
+    }
+}
+
+void
+NodeObserverTopic::flushUpdates()
+{
+    lock_guard lock(_mutex);
+    _flushScheduled = false;
+    if (_topics.empty())
+    {
+        return;
+    }
+
+    for (const auto& [isServer, key] : _updateOrder)
+    {
+        if (isServer)
+        {
+            publishServer(key.first, _serverUpdates.at(key));
+        }
+        else
+        {
+            publishAdapter(key.first, _adapterUpdates.at(key));
+        }
+    }
+    _updateOrder.clear();
+    _serverUpdates.clear();
+    _adapterUpdates.clear();
+}
+
+void
+NodeObserverTopic::discardUpdates(const string& node)
+{
+    // Must be called with the lock held. The updates of a node are obsolete once the node is up again or down, the
+    // observers receive its state with nodeUp or nodeDown.
+    auto p = _serverUpdates.lower_bound({node, ""});
+    while (p != _serverUpdates.end() && p->first.first == node)
+    {
+        p = _serverUpdates.erase(p);
+    }
+
+    auto q = _adapterUpdates.lower_bound({node, ""});
+    while (q != _adapterUpdates.end() && q->first.first == node)
+    {
+        q = _adapterUpdates.erase(q);
+    }
+
+    _updateOrder.erase(
+        remove_if(
+            _updateOrder.begin(),
+            _updateOrder.end(),
+            [&node](const auto& update) { return update.second.first == node; }),
+        _updateOrder.end());
+}
+
 bool
 NodeObserverTopic::isServerEnabled(const string& server) const
 {
@@ -704,7 +821,8 @@ ApplicationObserverTopic::applicationUpdated(int64_t dbSerial, const Application
         auto p = _applications.find(info.descriptor.name);
         if (p != _applications.end())
         {
-            ApplicationHelper helper(_publishers[0]->ice_getCommunicator(), p->second.descriptor);
+            // Applying the update only requires the application definition, there's no need to instantiate it.
+            ApplicationHelper helper(_publishers[0]->ice_getCommunicator(), p->second.descriptor, false, false);
             p->second.descriptor = helper.update(info.descriptor);
             p->second.updateTime = info.updateTime;
             p->second.updateUser = info.updateUser;
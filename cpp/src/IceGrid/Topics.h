@@ -3,9 +3,12 @@
 #ifndef ICEGRID_TOPICS_H
 #define ICEGRID_TOPICS_H
 
+#include "../Ice/Timer.h"
 #include "IceGrid/Registry.h"
 #include "IceStorm/IceStorm.h"
 #include "Internal.h"
+
+#include <chrono>
 #include <set>
 
 namespace IceGrid
@@ -77,7 +80,7 @@ namespace IceGrid
     {
     public:
         static std::shared_ptr<NodeObserverTopic>
-        create(const IceStorm::TopicManagerPrx&, const Ice::ObjectAdapterPtr&);
+        create(const IceStorm::TopicManagerPrx&, const Ice::ObjectAdapterPtr&, std::chrono::milliseconds);
 
         void nodeInit(NodeDynamicInfoSeq, const Ice::Current&) override;
         void nodeUp(NodeDynamicInfo, const Ice::Current&) override;
@@ -93,12 +96,30 @@ namespace IceGrid
         [[nodiscard]] bool isServerEnabled(const std::string&) const;
 
     private:
-        NodeObserverTopic(const IceStorm::TopicManagerPrx&, NodeObserverPrx);
+        NodeObserverTopic(const IceStorm::TopicManagerPrx&, NodeObserverPrx, std::chrono::milliseconds);
+
+        void publishServer(const std::string&, const ServerDynamicInfo&);
+        void publishAdapter(const std::string&, const AdapterDynamicInfo&);
+        void scheduleFlush();
+        void flushUpdates();
+        void discardUpdates(const std::string&);
 
         const NodeObserverPrx _externalPublisher;
         std::vector<NodeObserverPrx> _publishers;
         std::map<std::string, NodeDynamicInfo> _nodes;
         std::map<std::string, bool> _serverStatus;
+
+        // With a non-zero update period, the server and adapter updates are published at the end of the period
+        // and only the last update of each server or adapter is published. The updates are keyed by node and by
+        // server or adapter ID. The updates are published in the order their server or adapter was first updated
+        // during the period, to preserve the interleaving of server and adapter updates.
+        const std::chrono::milliseconds _updatePeriod;
+        IceInternal::TimerPtr _timer;
+        IceInternal::TimerTaskPtr _flushTask;
+        bool _flushScheduled{false};
+        std::map<std::pair<std::string, std::string>, ServerDynamicInfo> _serverUpdates;
+        std::map<std::pair<std::string, std::string>, AdapterDynamicInfo> _adapterUpdates;
+        std::vector<std::pair<bool, std::pair<std::string, std::string>>> _updateOrder; // true for a server update
     };
 
     class ApplicationObserverTopic final : public ObserverTopic
@@ -0,0 +1,59 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICEGRID_API_EXPORTS
+#    define ICEGRID_API_EXPORTS
+#endif
+
+#include "../Ice/LocatorInfo.h"
+#include "IceGrid/IceGrid.h"
+
+#include <set>
+
+using namespace std;
+using namespace IceGrid;
+
+void
+IceGrid::prefetchLocatorCache(
+    const LocatorPrx& locator,
+    const Ice::StringSeq& adapterIds,
+    const Ice::IdentitySeq& objectIds)
+{
+    vector<pair<string, optional<Ice::ObjectPrx>>> adapters;
+    vector<pair<Ice::Identity, optional<Ice::ObjectPrx>>> objects;
+    try
+    {
+        //
+        // Resolve the objects first, to resolve their adapters with the other adapters.
+        //
+        set<string> ids(adapterIds.begin(), adapterIds.end());
+        if (!objectIds.empty())
+        {
+            Ice::ObjectProxySeq proxies = locator->findObjectsByIds(objectIds);
+            for (size_t i = 0; i < objectIds.size() && i < proxies.size(); ++i)
+            {
+                if (proxies[i] && !proxies[i]->ice_getAdapterId().empty())
+                {
+                    ids.insert(proxies[i]->ice_getAdapterId());
+                }
+                objects.emplace_back(objectIds[i], proxies[i]);
+            }
+        }
+
+        if (!ids.empty())
+        {
+            Ice::StringSeq idSeq(ids.begin(), ids.end());
+            Ice::ObjectProxySeq proxies = locator->findAdaptersByIds(idSeq);
+            for (size_t i = 0; i < idSeq.size() && i < proxies.size(); ++i)
+            {
+                adapters.emplace_back(idSeq[i], proxies[i]);
+            }
+        }
+    }
+    catch (const Ice::OperationNotExistException&)
+    {
+        // The registry doesn't support bulk requests, the proxies are resolved when they are first used.
+        return;
+    }
+
+    IceInternal::addToLocatorCache(locator, adapters, objects);
+}
@@ -124,6 +124,16 @@ Instance::Instance(
             const_cast<chrono::milliseconds&>(_flushInterval) = chrono::milliseconds(1000);
         }
 
+        // The multicast groups are parsed once: the topics and their subscribers then only look up the proxy.
+        const string prefix = "IceStorm.Multicast.";
+        for (const auto& [property, value] : properties->getPropertiesForPrefix(prefix))
+        {
+            if (auto group = parseMulticastProxy(property, value))
+            {
+                _multicastProxies.emplace(property.substr(prefix.size()), *group);
+            }
+        }
+
         //
         // If an Ice metrics observer is setup on the communicator, also
         // enable metrics for IceStorm.
@@ -276,6 +286,48 @@ Instance::sendQueueSizeMaxPolicy() const
     return _sendQueueSizeMaxPolicy;
 }
 
+optional<Ice::ObjectPrx>
+Instance::multicastProxy(const string& topic) const
+{
+    auto p = _multicastProxies.find(topic);
+    if (p == _multicastProxies.end())
+    {
+        return nullopt;
+    }
+    return p->second;
+}
+
+optional<Ice::ObjectPrx>
+Instance::parseMulticastProxy(const string& property, const string& value) const
+{
+    if (value.empty())
+    {
+        return nullopt;
+    }
+
+    try
+    {
+        Ice::ObjectPrx proxy{_communicator, value};
+        for (const auto& endpoint : proxy->ice_getEndpoints())
+        {
+            if (!endpoint->getInfo()->datagram())
+            {
+                Ice::Warning warn(_traceLevels->logger);
+                warn << "invalid value '" << value << "' for '" << property
+                     << "': the multicast group proxy must only have UDP endpoints";
+                return nullopt;
+            }
+        }
+        return proxy->ice_datagram();
+    }
+    catch (const Ice::ParseException& ex)
+    {
+        Ice::Warning warn(_traceLevels->logger);
+        warn << "invalid value '" << value << "' for '" << property << "':\n" << ex;
+        return nullopt;
+    }
+}
+
 void
 Instance::shutdown() noexcept
 {
@@ -75,10 +75,16 @@ namespace IceStorm
         [[nodiscard]] int sendQueueSizeMax() const;
         [[nodiscard]] SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
 
+        // Returns the datagram proxy of the multicast group configured for the given topic with
+        // IceStorm.Multicast.<topic>, or nullopt if the topic doesn't use multicast delivery.
+        [[nodiscard]] std::optional<Ice::ObjectPrx> multicastProxy(const std::string&) const;
+
         void shutdown() noexcept;
         virtual void destroy() noexcept;
 
     private:
+        [[nodiscard]] std::optional<Ice::ObjectPrx> parseMulticastProxy(const std::string&, const std::string&) const;
+
         const std::string _instanceName;
         const Ice::CommunicatorPtr _communicator;
         const Ice::ObjectAdapterPtr _publishAdapter;
@@ -94,6 +100,7 @@ namespace IceStorm
         const std::optional<Ice::ObjectPrx> _topicReplicaProxy;
         const std::optional<Ice::ObjectPrx> _publisherReplicaProxy;
         const std::shared_ptr<TopicReaper> _topicReaper;
+        std::map<std::string, Ice::ObjectPrx> _multicastProxies; // The multicast group of each topic, if any.
         std::shared_ptr<IceStormElection::NodeI> _node;
         std::shared_ptr<IceStormElection::Observers> _observers;
         IceInternal::TimerPtr _timer;
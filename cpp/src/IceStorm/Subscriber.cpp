@@ -83,6 +83,12 @@ namespace
         }
         return nullopt;
     }
+
+    bool isMulticast(const QoS& qos)
+    {
+        auto p = qos.find("multicast");
+        return p != qos.end() && toInt(p->second).value_or(0) > 0;
+    }
 }
 
 // Each of the various Subscriber types.
@@ -602,6 +608,20 @@ Subscriber::create(const shared_ptr<Instance>& instance, const SubscriberRecord&
             newObj = newObj->ice_connectionCached(*value > 0);
         }
 
+        p = rec.theQoS.find("multicast");
+        if (p != rec.theQoS.end())
+        {
+            auto value = toInt(p->second);
+            if (!value)
+            {
+                throw BadQoS("invalid multicast setting (numeric value required): " + p->second);
+            }
+            if (*value > 0 && !instance->multicastProxy(rec.topicName))
+            {
+                throw BadQoS("multicast delivery is not configured for topic '" + rec.topicName + "'");
+            }
+        }
+
         shared_ptr<Subscriber> subscriber;
         if (reliability == "ordered")
         {
@@ -986,7 +1006,8 @@ Subscriber::Subscriber(
       _retryCount(retryCount),
       _maxOutstanding(maxOutstanding),
       _proxy(std::move(proxy)),
-      _proxyReplica(_proxy)
+      _proxyReplica(_proxy),
+      _multicast(!_rec.link && isMulticast(_rec.theQoS))
 {
     if (_proxy && _instance->publisherReplicaProxy())
     {
@@ -1060,3 +1081,73 @@ IceStorm::operator==(const shared_ptr<Subscriber>& subscriber, const Ice::Identi
 {
     return subscriber->id() == id;
 }
+
+shared_ptr<MulticastPublisher>
+MulticastPublisher::create(const shared_ptr<Instance>& instance, const string& topicName)
+{
+    auto group = instance->multicastProxy(topicName);
+    if (!group)
+    {
+        return nullptr;
+    }
+    return make_shared<MulticastPublisher>(instance, topicName, *group);
+}
+
+MulticastPublisher::MulticastPublisher(shared_ptr<Instance> instance, string topicName, Ice::ObjectPrx group)
+    : _instance(std::move(instance)),
+      _topicName(std::move(topicName)),
+      _group(std::move(group))
+{
+    assert(_group->ice_isDatagram());
+}
+
+void
+MulticastPublisher::publish(const EventDataSeq& events)
+{
+    // The datagrams are only queued here, the sends don't wait for the network. Holding the lock while queuing them
+    // writes the events to the group in sequence order.
+    lock_guard lock(_mutex);
+
+    for (const auto& e : events)
+    {
+        Ice::Context ctx = e.context;
+        ctx["_seq"] = to_string(++_sequence);
+
+        try
+        {
+            // The group proxy is a datagram proxy: the send completes (or fails) without a response.
+            _group->ice_invokeAsync(
+                e.op,
+                e.mode,
+                e.data,
+                nullptr,
+                [self = shared_from_this()](exception_ptr ex) { self->error(ex); },
+                nullptr,
+                ctx);
+        }
+        catch (const std::exception&)
+        {
+            error(current_exception());
+        }
+    }
+}
+
+void
+MulticastPublisher::error(exception_ptr ex)
+{
+    // A lost datagram is reported to the subscribers as a gap in the sequence numbers; there is nothing to retry.
+    auto traceLevels = _instance->traceLevels();
+    if (traceLevels->subscriber > 0)
+    {
+        try
+        {
+            rethrow_exception(ex);
+        }
+        catch (const std::exception& e)
+        {
+            Ice::Trace out(traceLevels->logger, traceLevels->subscriberCat);
+            out << _topicName << ": multicast send to " << IceStormInternal::describeEndpoints(_group)
+                << " failed: " << e.what();
+        }
+    }
+}
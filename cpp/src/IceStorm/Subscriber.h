@@ -39,6 +39,10 @@ namespace IceStorm
         [[nodiscard]] Ice::Identity id() const;                    // Return the id of the subscriber.
         [[nodiscard]] IceStorm::SubscriberRecord record() const;   // Get the subscriber record.
 
+        // Returns true if the subscriber receives the topic's events through the topic's multicast group rather than
+        // through its own proxy.
+        [[nodiscard]] bool multicast() const { return _multicast; }
+
         // Returns false if the subscriber should be reaped.
         bool queue(bool, EventDataSeq);
         bool reap();
@@ -77,6 +81,7 @@ namespace IceStorm
         const int _maxOutstanding;                         // The maximum number of outstanding events.
         const std::optional<Ice::ObjectPrx> _proxy;        // The per subscriber object proxy, if any.
         const std::optional<Ice::ObjectPrx> _proxyReplica; // The replicated per subscriber object proxy, if any.
+        const bool _multicast;                             // Set with the multicast QoS.
 
         mutable std::recursive_mutex _mutex;
         std::condition_variable_any _condVar;
@@ -98,6 +103,34 @@ namespace IceStorm
     };
 
     bool operator==(const std::shared_ptr<IceStorm::Subscriber>&, const Ice::Identity&);
+
+    // Sends the events published on a topic once to the topic's multicast group (see Instance::multicastProxy), on
+    // behalf of all the subscribers of this topic that subscribed with the multicast QoS. Delivery is best-effort: each
+    // event carries a "_seq" context entry with a per-topic sequence number, starting at 1, which the subscribers can
+    // use to detect lost or reordered datagrams.
+    class MulticastPublisher final : public std::enable_shared_from_this<MulticastPublisher>
+    {
+    public:
+        // Returns null if no multicast group is configured for the topic.
+        static std::shared_ptr<MulticastPublisher> create(const std::shared_ptr<Instance>&, const std::string&);
+
+        MulticastPublisher(std::shared_ptr<Instance>, std::string, Ice::ObjectPrx);
+
+        void publish(const EventDataSeq&);
+
+    private:
+        void error(std::exception_ptr);
+
+        // Immutable
+        const std::shared_ptr<Instance> _instance;
+        const std::string _topicName;
+        const Ice::ObjectPrx _group;
+
+        // Serializes the sequence number assignment and the sends, so that events are written to the group in
+        // sequence order.
+        std::mutex _mutex;
+        std::int64_t _sequence{0};
+    };
 }
 
 #if defined(__clang__)
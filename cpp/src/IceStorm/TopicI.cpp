@@ -392,6 +392,7 @@ TopicImpl::TopicImpl(
     : _instance(std::move(instance)),
       _name(std::move(name)),
       _id(std::move(id)),
+      _multicastPublisher(MulticastPublisher::create(_instance, _name)),
       _lluMap(_instance->lluMap()),
       _subscriberMap(_instance->subscriberMap())
 {
@@ -895,8 +896,23 @@ TopicImpl::update(const SubscriberRecordSeq& records)
         }
         if (q == _subscribers.end())
         {
-            auto subscriber = Subscriber::create(_instance, record);
-            _subscribers.push_back(subscriber);
+            try
+            {
+                _subscribers.push_back(Subscriber::create(_instance, record));
+            }
+            catch (const Ice::Exception& ex)
+            {
+                // For example, a multicast subscriber while this replica has no multicast group for the topic: skip
+                // this subscriber rather than failing the whole synchronization.
+                auto traceLevels = _instance->traceLevels();
+                Ice::Warning out(traceLevels->logger);
+                out << _name << " recreate " << _instance->communicator()->identityToString(record.id);
+                if (traceLevels->topic > 1)
+                {
+                    out << " endpoints: " << IceStormInternal::describeEndpoints(record.obj);
+                }
+                out << " failed: " << ex;
+            }
         }
     }
 }
@@ -967,14 +983,26 @@ TopicImpl::publish(bool forwarded, const EventDataSeq& events)
         // Queue each event, gathering a list of those subscribers that
         // must be reaped.
         //
+        bool multicast = false;
         for (const auto& subscriber : copy)
         {
+            if (_multicastPublisher && subscriber->multicast())
+            {
+                multicast = true;
+                continue;
+            }
             if (!subscriber->queue(forwarded, events) && subscriber->reap())
             {
                 reap.push_back(subscriber->id());
             }
         }
 
+        // The subscribers with the multicast QoS all receive the events from a single send to the topic's group.
+        if (multicast)
+        {
+            _multicastPublisher->publish(events);
+        }
+
         // If there are no subscribers in error then we're done.
         if (reap.empty())
         {
@@ -1063,14 +1091,28 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
         return;
     }
 
-    auto subscriber = Subscriber::create(_instance, record);
+    shared_ptr<Subscriber> subscriber;
+    try
+    {
+        subscriber = Subscriber::create(_instance, record);
+    }
+    catch (const BadQoS& ex)
+    {
+        // The master accepted a QoS this replica doesn't support, for example multicast delivery without a multicast
+        // group for the topic. The record is still saved to keep the database in sync with the master, but this
+        // replica doesn't deliver events to the subscriber.
+        Ice::Warning out(traceLevels->logger);
+        out << _name << ": add replica observer: " << _instance->communicator()->identityToString(record.id)
+            << " failed: " << ex;
+    }
+
     try
     {
         IceDB::ReadWriteTxn txn(_instance->dbEnv());
 
         SubscriberRecordKey key;
         key.topic = _id;
-        key.id = subscriber->id();
+        key.id = record.id;
 
         _subscriberMap.put(txn, key, record);
 
@@ -1084,11 +1126,17 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
         logError(_instance->communicator(), ex);
         // The subscriber was created (and its publisher servant registered) before the transaction; remove
         // it so a later replica sync does not fail re-registering the same subscriber identity.
-        subscriber->destroy();
+        if (subscriber)
+        {
+            subscriber->destroy();
+        }
         throw; // will become UnknownException in caller
     }
 
-    _subscribers.push_back(subscriber);
+    if (subscriber)
+    {
+        _subscribers.push_back(subscriber);
+    }
 }
 
 void
@@ -16,6 +16,7 @@ namespace IceStorm
     // Forward declarations
     class PersistentInstance;
     class Subscriber;
+    class MulticastPublisher;
 
     class TopicImpl
     {
@@ -94,6 +95,10 @@ namespace IceStorm
 
         bool _destroyed{false}; // Has this Topic been destroyed?
 
+        // Sends the events once to the topic's multicast group for the subscribers with the multicast QoS; null if
+        // the topic has no multicast group.
+        const std::shared_ptr<MulticastPublisher> _multicastPublisher;
+
         LLUMap _lluMap;
         SubscriberMap _subscriberMap;
     };
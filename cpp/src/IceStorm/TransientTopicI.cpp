@@ -102,7 +102,8 @@ TransientTopicImpl::create(const shared_ptr<Instance>& instance, const std::stri
 TransientTopicImpl::TransientTopicImpl(shared_ptr<Instance> instance, std::string name, Ice::Identity id)
     : _instance(std::move(instance)),
       _name(std::move(name)),
-      _id(std::move(id))
+      _id(std::move(id)),
+      _multicastPublisher(MulticastPublisher::create(_instance, _name))
 {
     if (_instance->observer())
     {
@@ -437,14 +438,26 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
     // must be reaped.
     //
     vector<Ice::Identity> ids;
+    bool multicast = false;
     for (const auto& subscriber : copy)
     {
+        if (_multicastPublisher && subscriber->multicast())
+        {
+            multicast = true;
+            continue;
+        }
         if (!subscriber->queue(forwarded, events) && subscriber->reap())
         {
             ids.push_back(subscriber->id());
         }
     }
 
+    // The subscribers with the multicast QoS all receive the events from a single send to the topic's group.
+    if (multicast)
+    {
+        _multicastPublisher->publish(events);
+    }
+
     //
     // Run through the error list removing those subscribers that are
     // in error from the subscriber list.
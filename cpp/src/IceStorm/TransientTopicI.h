@@ -12,6 +12,7 @@ namespace IceStorm
     // Forward declarations.
     class Instance;
     class Subscriber;
+    class MulticastPublisher;
 
     class TransientTopicImpl : public TopicInternal
     {
@@ -67,6 +68,10 @@ namespace IceStorm
 
         bool _destroyed{false}; // Has this Topic been destroyed?
 
+        // Sends the events once to the topic's multicast group for the subscribers with the multicast QoS; null if
+        // the topic has no multicast group.
+        const std::shared_ptr<MulticastPublisher> _multicastPublisher;
+
         IceInternal::ObserverHelperT<IceStorm::Instrumentation::TopicObserver> _observer;
 
         mutable std::mutex _mutex;
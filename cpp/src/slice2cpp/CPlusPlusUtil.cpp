@@ -65,6 +65,16 @@ namespace
         {
             strType += "_view";
         }
+        else if (
+            (typeCtx & TypeContext::UnmarshalParamZeroCopy) != TypeContext::None && strType == "std::string" &&
+            any_of(
+                metadata.begin(),
+                metadata.end(),
+                [](const MetadataPtr& meta) { return meta->directive() == "cpp:view"; }))
+        {
+            // A zero-copy view into the InputStream buffer, valid until the dispatch or the response callback returns.
+            strType = "std::string_view";
+        }
         return strType;
     }
 
@@ -1055,6 +1065,23 @@ Slice::Cpp::validateCppMetadata(const UnitPtr& unit)
     };
     knownMetadata.emplace("cpp:source-include", std::move(sourceIncludeInfo));
 
+    // "cpp:view"
+    MetadataInfo viewInfo = {
+        .validOn = {}, // Setting it to an empty list skips this validation step. We do it all in `extraValidation`.
+        .acceptedArgumentKind = MetadataArgumentKind::NoArguments,
+        .acceptedContext = MetadataApplicationContext::ParameterTypeReferences,
+        .extraValidation = [](const MetadataPtr& meta, const SyntaxTreeBasePtr& p) -> optional<string>
+        {
+            // 'cpp:view' maps an unmarshaled string parameter to a string_view. Use 'cpp:array' for sequences.
+            if (auto builtin = dynamic_pointer_cast<Builtin>(p); builtin && builtin->kind() == Builtin::KindString)
+            {
+                return nullopt;
+            }
+            return Slice::misappliedMetadataMessage(meta, p);
+        },
+    };
+    knownMetadata.emplace("cpp:view", std::move(viewInfo));
+
     // "cpp:view-type"
     MetadataInfo viewTypeInfo = {
         .validOn = {typeid(Sequence)},
@@ -8,7 +8,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <limits>
+#include <map>
 #include <string>
 
 using namespace std;
@@ -68,6 +70,153 @@ namespace
         }
     }
 
+    // The hash of an operation name used by the generated dispatch functions: 32-bit FNV-1a. The generated code
+    // computes the same hash.
+    uint32_t operationHash(const string& name)
+    {
+        uint32_t hash = 2166136261U;
+        for (char c : name)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619U;
+        }
+        return hash;
+    }
+
+    // A perfect hash of the operation names of an interface, built with the hash and displace method: the top
+    // bucketBits bits of the hash of a name select a bucket, and the name maps to the case
+    // ((hash ^ seeds[bucket]) * 2654435769) >> (32 - caseBits) of the dispatch switch. The seed of each bucket is
+    // chosen so that all the names map to distinct cases.
+    struct DispatchHash
+    {
+        vector<uint32_t> seeds;
+        int bucketBits;
+        int caseBits;
+
+        [[nodiscard]] uint32_t caseOf(uint32_t hash) const
+        {
+            return ((hash ^ seeds[hash >> (32 - bucketBits)]) * 2654435769U) >> (32 - caseBits);
+        }
+    };
+
+    DispatchHash findDispatchHash(const list<pair<string, string>>& opNames)
+    {
+        int bits = 1;
+        while ((size_t{1} << bits) < opNames.size())
+        {
+            ++bits;
+        }
+
+        // About two names per bucket, and a switch with two to eight times as many cases as names.
+        DispatchHash dispatchHash{{}, max(bits - 1, 1), bits + 1};
+        for (; dispatchHash.caseBits <= bits + 3; ++dispatchHash.caseBits)
+        {
+            vector<vector<uint32_t>> buckets(size_t{1} << dispatchHash.bucketBits);
+            for (const auto& opName : opNames)
+            {
+                uint32_t hash = operationHash(opName.first);
+                buckets[hash >> (32 - dispatchHash.bucketBits)].push_back(hash);
+            }
+
+            // Place the largest buckets first, while most cases are free.
+            vector<size_t> order(buckets.size());
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i] = i;
+            }
+            stable_sort(
+                order.begin(),
+                order.end(),
+                [&buckets](size_t lhs, size_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+            dispatchHash.seeds.assign(buckets.size(), 0);
+            vector<bool> used(size_t{1} << dispatchHash.caseBits);
+            bool placed = true;
+            for (size_t bucket : order)
+            {
+                placed = false;
+                for (uint32_t seed = 0; seed < 65536 && !placed; ++seed)
+                {
+                    dispatchHash.seeds[bucket] = seed;
+                    vector<uint32_t> cases;
+                    for (auto hash : buckets[bucket])
+                    {
+                        uint32_t value = dispatchHash.caseOf(hash);
+                        if (used[value] || find(cases.begin(), cases.end(), value) != cases.end())
+                        {
+                            break;
+                        }
+                        cases.push_back(value);
+                    }
+                    if (cases.size() == buckets[bucket].size())
+                    {
+                        for (auto value : cases)
+                        {
+                            used[value] = true;
+                        }
+                        placed = true;
+                    }
+                }
+                if (!placed)
+                {
+                    break;
+                }
+            }
+            if (placed)
+            {
+                return dispatchHash;
+            }
+        }
+
+        // No perfect hash, which is very unlikely. The generated switch compares the operation with each name of a
+        // case, so the dispatch remains correct with names sharing a case.
+        dispatchHash.caseBits = bits + 3;
+        dispatchHash.seeds.assign(size_t{1} << dispatchHash.bucketBits, 0);
+        return dispatchHash;
+    }
+
+    // Returns true if the mapped struct can have the same memory layout as its Slice encoding: all its data members are
+    // fixed-size integer and floating point types, or structs with this property. The generated code then checks at
+    // compile time that the mapped struct has no padding, and the target is little-endian.
+    bool hasWireLayout(const StructPtr& p)
+    {
+        for (const auto& member : p->dataMembers())
+        {
+            TypePtr type = member->type();
+            if (auto builtin = dynamic_pointer_cast<Builtin>(type))
+            {
+                switch (builtin->kind())
+                {
+                    case Builtin::KindByte:
+                    case Builtin::KindShort:
+                    case Builtin::KindInt:
+                    case Builtin::KindLong:
+                    case Builtin::KindFloat:
+                    case Builtin::KindDouble:
+                    {
+                        break;
+                    }
+                    default:
+                    {
+                        // bool is excluded too: a byte other than 0 or 1 isn't a valid bool value.
+                        return false;
+                    }
+                }
+            }
+            else if (auto st = dynamic_pointer_cast<Struct>(type))
+            {
+                if (!hasWireLayout(st))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     string getDeprecatedAttribute(const ContainedPtr& p1)
     {
         string deprecatedAttribute;
@@ -746,8 +895,8 @@ Slice::Gen::generate(const UnitPtr& unit)
     C << "\n#include <Ice/AsyncResponseHandler.h>"; // for async dispatches
     C << "\n#include <Ice/DefaultSliceLoader.h>";   // for class and exception unmarshaling
     C << "\n#include <Ice/OutgoingAsync.h>";        // for proxies
-    C << "\n#include <algorithm>";                  // for the dispatch implementation
     C << "\n#include <array>";                      // for the dispatch implementation
+    C << "\n#include <cstdint>";                    // for the dispatch implementation
 
     // Disable shadow and deprecation warnings in .cpp file
     C << sp;
@@ -2617,49 +2766,58 @@ Slice::InterfaceVisitor::visitInterfaceDefStart(const InterfaceDefPtr& p)
           << "::dispatch(Ice::IncomingRequest& request, std::function<void(Ice::OutgoingResponse)> sendResponse)";
         C << sb;
 
+        // Find the operation with a perfect hash of its name, computed by findDispatchHash.
+        DispatchHash dispatchHash = findDispatchHash(allOpNames);
+        map<uint32_t, list<pair<string, string>>> cases;
+        for (const auto& opNames : allOpNames)
+        {
+            cases[dispatchHash.caseOf(operationHash(opNames.first))].push_back(opNames);
+        }
+
         C << sp;
-        C << nl << "static constexpr std::array<std::string_view, " << allOpNames.size() << "> allOperations";
+        C << nl << "static constexpr std::array<std::uint32_t, " << dispatchHash.seeds.size() << "> seeds";
         C.spar("{");
-        for (const auto& opNames : allOpNames)
+        for (auto seed : dispatchHash.seeds)
         {
-            C << '"' + opNames.first + '"';
+            C << to_string(seed) + "U";
         }
         C.epar("}");
         C << ";";
 
         C << sp;
         C << nl << "const Ice::Current& current = request.current();";
-        C << nl << "auto r = std::equal_range(allOperations.begin(), allOperations.end(), current.operation);";
-        // range is a C++ 20 feature and we want to keep the generated code C++17 compatible and lint-free.
-        C << " // NOLINT(modernize-use-ranges)";
-        C << nl << "if (r.first == r.second)";
+        C << nl << "std::uint32_t hash = 2166136261U;";
+        C << nl << "for (char c : current.operation)";
         C << sb;
-        C << nl
-          << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
-             "FILE__, __LINE__}), current));";
-        C << nl << "return;";
+        C << nl << "hash = (hash ^ static_cast<unsigned char>(c)) * 16777619U;";
         C << eb;
-        C << sp;
-        C << nl << "switch (r.first - allOperations.begin())";
+        C << nl << "switch (((hash ^ seeds[hash >> " << (32 - dispatchHash.bucketBits) << "]) * 2654435769U) >> "
+          << (32 - dispatchHash.caseBits) << ")";
         C << sb;
-        int i = 0;
-        for (const auto& opNames : allOpNames)
+        for (const auto& [value, caseOpNames] : cases)
         {
-            C << nl << "case " << i++ << ':';
+            C << nl << "case " << value << ':';
             C << sb;
-            C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+            for (const auto& opNames : caseOpNames)
+            {
+                C << nl << "if (current.operation == \"" << opNames.first << "\")";
+                C << sb;
+                C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+                C << nl << "return;";
+                C << eb;
+            }
             C << nl << "break;";
             C << eb;
         }
         C << nl << "default:";
         C << sb;
-        C << nl << "assert(false);";
+        C << nl << "break;";
+        C << eb;
+        C << eb;
         C << nl
           << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
              "FILE__, __LINE__}), current));";
         C << eb;
-        C << eb;
-        C << eb;
     }
 
     H << sp;
@@ -3142,6 +3300,7 @@ Slice::StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "static constexpr StreamHelperCategory helper = StreamHelperCategoryStruct;";
     H << nl << "static constexpr int minWireSize = " << p->minWireSize() << ";";
     H << nl << "static constexpr bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
+    H << nl << "static constexpr bool wireLayout = " << (hasWireLayout(p) ? "true" : "false") << ";";
     H << eb << ";";
     H << sp;
 
@@ -209,6 +209,11 @@ Test::TestHelper::getTestEndpoint(const Ice::PropertiesPtr& properties, int num,
             }
         }
     }
+    else if (protocol == "shm")
+    {
+        // Shared memory endpoints are identified by a name instead of a port.
+        ostr << "shm -n test-" << (basePort + num);
+    }
     else
     {
         ostr << protocol << " -p " << (basePort + num);
@@ -162,6 +162,19 @@ void ::Writer::run(int argc, char* argv[])
                 }
             }
 
+            // A negative batch size is rejected, a batch size of 0 doesn't limit the size of the sample batches.
+            {
+                Ice::CommunicatorHolder holder{Ice::initialize(makeInitData("DataStorm.Topic.BatchSize", "-1"))};
+                try
+                {
+                    Node n18{holder.communicator()};
+                    test(false);
+                }
+                catch (const invalid_argument&)
+                {
+                }
+            }
+
             // Retry properties are parsed before the DataStorm adapters are created, leaving a user-supplied
             // communicator reusable when parsing fails.
             {
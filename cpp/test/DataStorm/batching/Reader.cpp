@@ -0,0 +1,55 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+using namespace DataStorm;
+using namespace std;
+
+class Reader : public Test::TestHelper
+{
+public:
+    Reader() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+void ::Reader::run(int argc, char* argv[])
+{
+    Node node(argc, argv);
+
+    Topic<string, bool> doneTopic(node, "done");
+    auto done = makeSingleKeyWriter(doneTopic, "done");
+    const ReaderConfig config(-1, nullopt, ClearHistoryPolicy::Never);
+
+    {
+        Topic<int, int> topic(node, "batching");
+        auto reader = makeSingleKeyReader(topic, 0, "", config);
+        for (int i = 0; i < 10; ++i)
+        {
+            test(reader.getNextUnread().getValue() == i);
+        }
+        done.add(true);
+    }
+
+    {
+        Topic<int, int> topic(node, "ordering");
+        auto reader = makeSingleKeyReader(topic, 0, "", config);
+        reader.waitForWriters();
+        done.update(true);
+
+        // The writer detaches once its samples are sent: they're all received when it's gone.
+        reader.waitForNoWriters();
+        auto samples = reader.getAllUnread();
+        test(samples.size() == 5);
+        for (int i = 0; i < 5; ++i)
+        {
+            test(samples[static_cast<size_t>(i)].getValue() == i);
+        }
+        done.update(true);
+    }
+
+    done.waitForNoReaders();
+}
+
+DEFINE_TEST(::Reader)
@@ -0,0 +1,60 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+using namespace DataStorm;
+using namespace std;
+
+class Writer : public Test::TestHelper
+{
+public:
+    Writer() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+void ::Writer::run(int argc, char* argv[])
+{
+    // The writers batch their samples with DataStorm.Topic.BatchInterval=10000 and DataStorm.Topic.BatchSize=10.
+    Node node(argc, argv);
+
+    Topic<string, bool> doneTopic(node, "done");
+    auto done = makeSingleKeyReader(doneTopic, "done");
+
+    cout << "testing batched samples... " << flush;
+    {
+        // A full batch is sent without waiting for the batch interval.
+        Topic<int, int> topic(node, "batching");
+        auto writer = makeSingleKeyWriter(topic, 0);
+        writer.waitForReaders();
+
+        const auto start = chrono::steady_clock::now();
+        writer.add(0);
+        for (int i = 1; i < 10; ++i)
+        {
+            writer.update(i);
+        }
+        test(done.getNextUnread().getValue());
+        test(chrono::steady_clock::now() - start < 5s);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing batched samples ordering... " << flush;
+    {
+        // The samples of an incomplete batch are sent before the writer detaches from the reader.
+        Topic<int, int> topic(node, "ordering");
+        auto writer = makeSingleKeyWriter(topic, 0);
+        test(done.getNextUnread().getValue()); // The reader is attached.
+
+        writer.add(0);
+        for (int i = 1; i < 5; ++i)
+        {
+            writer.update(i);
+        }
+    }
+    test(done.getNextUnread().getValue());
+    cout << "ok" << endl;
+}
+
+DEFINE_TEST(::Writer)
@@ -0,0 +1,28 @@
+# Copyright (c) ZeroC, Inc.
+
+from DataStormUtil import Reader, Writer
+from Util import ClientServerTestCase, TestSuite
+
+traceProps = {
+    "DataStorm.Trace.Topic": 1,
+    "DataStorm.Trace.Session": 3,
+    "DataStorm.Trace.Data": 2,
+}
+
+# The batch interval is long enough for the test to fail if a batch is only sent once the interval elapses.
+batchProps = {
+    "DataStorm.Topic.BatchInterval": 10000,
+    "DataStorm.Topic.BatchSize": 10,
+}
+
+TestSuite(
+    __file__,
+    [
+        ClientServerTestCase(
+            name="Writer/Reader",
+            client=Writer(props=batchProps),
+            server=Reader(),
+            traceProps=traceProps,
+        )
+    ],
+)
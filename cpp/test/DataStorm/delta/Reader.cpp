@@ -0,0 +1,72 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+using namespace DataStorm;
+using namespace std;
+
+class Reader : public Test::TestHelper
+{
+public:
+    Reader() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+void ::Reader::run(int argc, char* argv[])
+{
+    Node node(argc, argv);
+
+    Topic<string, bool> doneTopic(node, "done");
+    auto done = makeSingleKeyWriter(doneTopic, "done");
+
+    {
+        Topic<string, string> topic(node, "delta");
+        const ReaderConfig config(-1, nullopt, ClearHistoryPolicy::Never);
+        auto reader = makeSingleKeyReader(topic, "key", "", config);
+
+        // The sample filter only matches every fifth update, most of which are sent to the other reader as deltas
+        // computed against updates this reader doesn't get.
+        auto filtered = makeSingleKeyReader(topic, "key", Filter<string>("_regex", ".*-[0-9]*[05]"), "", config);
+
+        const string prefix(64, 'x');
+        for (int i = 0; i < 20; ++i)
+        {
+            test(reader.getNextUnread().getValue() == prefix + "-" + to_string(i));
+        }
+        for (int i = 0; i < 20; i += 5)
+        {
+            test(filtered.getNextUnread().getValue() == prefix + "-" + to_string(i));
+        }
+    }
+
+    done.add(true);
+
+    {
+        Topic<string, string> topic(node, "lateDelta");
+        const ReaderConfig config(-1, nullopt, ClearHistoryPolicy::Never);
+        auto reader = makeSingleKeyReader(topic, "key", "", config);
+
+        const string prefix(64, 'y');
+        for (int i = 0; i < 5; ++i)
+        {
+            test(reader.getNextUnread().getValue() == prefix + "-" + to_string(i));
+        }
+
+        // The late reader gets the current value of the key first, and then every update, most of them as deltas
+        // computed against the values it got.
+        auto lateReader = makeSingleKeyReader(topic, "key", "", config);
+        test(lateReader.getNextUnread().getValue() == prefix + "-4");
+        for (int i = 5; i < 13; ++i)
+        {
+            test(reader.getNextUnread().getValue() == prefix + "-" + to_string(i));
+            test(lateReader.getNextUnread().getValue() == prefix + "-" + to_string(i));
+        }
+    }
+
+    done.update(true);
+    done.waitForNoReaders();
+}
+
+DEFINE_TEST(::Reader)
@@ -0,0 +1,69 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+using namespace DataStorm;
+using namespace std;
+
+class Writer : public Test::TestHelper
+{
+public:
+    Writer() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+void ::Writer::run(int argc, char* argv[])
+{
+    Node node(argc, argv);
+
+    Topic<string, bool> doneTopic(node, "done");
+    auto done = makeSingleKeyReader(doneTopic, "done");
+
+    cout << "testing delta encoded updates... " << flush;
+    {
+        // The values only differ by their last characters: with a keyframe interval of 4, the updates that aren't
+        // keyframes are sent as deltas to the reader, and as full values to the reader with a sample filter.
+        Topic<string, string> topic(node, "delta");
+        auto writer = makeSingleKeyWriter(topic, "key", "", WriterConfig(nullopt, nullopt, nullopt, nullopt, 4));
+        writer.waitForReaders(2);
+
+        const string prefix(64, 'x');
+        writer.add(prefix + "-0");
+        for (int i = 1; i < 20; ++i)
+        {
+            writer.update(prefix + "-" + to_string(i));
+        }
+
+        test(done.getNextUnread().getValue());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing delta encoded updates with a late reader... " << flush;
+    {
+        // The writer keeps no history: the reader created after the keyframe only gets the last value of the key
+        // when it joins, and must resolve the following deltas against it.
+        Topic<string, string> topic(node, "lateDelta");
+        auto writer = makeSingleKeyWriter(topic, "key", "", WriterConfig(0, nullopt, nullopt, nullopt, 8));
+        writer.waitForReaders();
+
+        const string prefix(64, 'y');
+        writer.add(prefix + "-0");
+        for (int i = 1; i < 5; ++i)
+        {
+            writer.update(prefix + "-" + to_string(i));
+        }
+
+        writer.waitForReaders(2);
+        for (int i = 5; i < 13; ++i)
+        {
+            writer.update(prefix + "-" + to_string(i));
+        }
+
+        test(done.getNextUnread().getValue());
+    }
+    cout << "ok" << endl;
+}
+
+DEFINE_TEST(::Writer)
@@ -564,6 +564,57 @@ void ::Reader::run(int argc, char* argv[])
         test(sample.getValue() == "value1");
     }
 
+    // Readers of different keys of a multi-key writer each receive only the samples of their keys. A new reader of a
+    // key whose reader was destroyed is subscribed again, and initialized with the key's previous sample.
+    {
+        Topic<string, string> topic(node, "keyListeners");
+        Topic<string, int> barrier(node, "keyListenersBarrier");
+
+        auto readerB = makeSingleKeyReader(topic, "b", "", config);
+        auto filteredReader = makeFilteredKeyReader(topic, Filter<string>("_regex", "c.*"), "", config);
+        auto anyKeyReader = makeAnyKeyReader(topic, "", config);
+        {
+            auto readerA = makeSingleKeyReader(topic, "a", "", config);
+            auto sample = readerA.getNextUnread();
+            test(sample.getKey() == "a");
+            test(sample.getValue() == "a1");
+        }
+
+        auto sample = readerB.getNextUnread();
+        test(sample.getKey() == "b");
+        test(sample.getValue() == "b1");
+        sample = filteredReader.getNextUnread();
+        test(sample.getKey() == "c1");
+        test(sample.getValue() == "c1");
+        for (const string key : {"a", "b", "c1", "d"})
+        {
+            sample = anyKeyReader.getNextUnread();
+            test(sample.getKey() == key);
+        }
+        test(!readerB.hasUnread());
+        test(!filteredReader.hasUnread());
+
+        auto readerA = makeSingleKeyReader(topic, "a", "", config);
+        readerA.waitForWriters(1);
+
+        // Signal that the reader of "a" is replaced; the writer then publishes "a" and "d" again.
+        auto barrierWriter = makeSingleKeyWriter(barrier, "barrier");
+        barrierWriter.waitForReaders();
+        barrierWriter.update(0);
+
+        test(readerA.getNextUnread().getValue() == "a1");
+        test(readerA.getNextUnread().getValue() == "a2");
+        sample = anyKeyReader.getNextUnread();
+        test(sample.getKey() == "a");
+        test(sample.getValue() == "a2");
+        sample = anyKeyReader.getNextUnread();
+        test(sample.getKey() == "d");
+        test(sample.getValue() == "d2");
+        test(!readerA.hasUnread());
+        test(!readerB.hasUnread());
+        test(!filteredReader.hasUnread());
+    }
+
     // A late-joining reader of a multi-key writer must receive the initialization samples of every key it
     // subscribes to.
     {
@@ -527,6 +527,29 @@ void ::Writer::run(int argc, char* argv[])
     }
     cout << "ok" << endl;
 
+    // Readers subscribing to different keys of a multi-key writer must each receive only the samples of their keys,
+    // including after a reader is replaced by a new reader of the same key.
+    cout << "testing multi-key writer with readers of different keys... " << flush;
+    {
+        Topic<string, string> topic(node, "keyListeners");
+        Topic<string, int> barrier(node, "keyListenersBarrier");
+
+        auto writer = makeMultiKeyWriter(topic, {"a", "b", "c1", "d"}, "", config);
+        writer.waitForReaders(4); // the readers of "a" and "b", the reader filtering "c.*" and the any-key reader
+        writer.update("a", "a1");
+        writer.update("b", "b1");
+        writer.update("c1", "c1");
+        writer.update("d", "d1");
+
+        // Wait until the peer replaced the reader of "a".
+        [[maybe_unused]] auto _ = makeSingleKeyReader(barrier, "barrier").getNextUnread();
+
+        writer.update("a", "a2");
+        writer.update("d", "d2");
+        writer.waitForNoReaders();
+    }
+    cout << "ok" << endl;
+
     // A late-joining reader of a multi-key writer must receive the initialization samples of every key it
     // subscribes to, not just the first key's batch.
     cout << "testing late-joining multi-key reader... " << flush;
@@ -0,0 +1,43 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+using namespace DataStorm;
+using namespace std;
+
+class Reader : public Test::TestHelper
+{
+public:
+    Reader() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+void ::Reader::run(int argc, char* argv[])
+{
+    Node node(argc, argv);
+
+    Topic<string, string> controlTopic(node, "control");
+    auto control = makeSingleKeyReader(controlTopic, "control");
+
+    Topic<string, string> doneTopic(node, "done");
+    auto done = makeSingleKeyWriter(doneTopic, "done");
+
+    if (control.getNextUnread().getValue() == "ready")
+    {
+        Topic<string, int> topic(node, "history");
+        auto reader = makeAnyKeyReader(topic, "", ReaderConfig(-1, nullopt, ClearHistoryPolicy::Never));
+        for (int i = 0; i < 10; ++i)
+        {
+            auto sample = reader.getNextUnread();
+            test(sample.getKey() == "k" + to_string(i % 3));
+            test(sample.getValue() == i);
+        }
+    }
+
+    done.add("done");
+    done.waitForNoReaders();
+}
+
+DEFINE_TEST(::Reader)
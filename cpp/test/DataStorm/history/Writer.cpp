@@ -0,0 +1,140 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "DataStorm/DataStorm.h"
+#include "TestHelper.h"
+
+#include <filesystem>
+#include <optional>
+
+using namespace DataStorm;
+using namespace std;
+
+class Writer : public Test::TestHelper
+{
+public:
+    Writer() : Test::TestHelper(false) {}
+
+    void run(int, char**) override;
+};
+
+namespace
+{
+    // Checks that the history of the any-key writer holds the samples published by publishAnyKey.
+    template<typename T> void checkAnyKeyHistory(T& writer, int count)
+    {
+        auto samples = writer.getAll();
+        test(samples.size() == static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            const auto& sample = samples[static_cast<size_t>(i)];
+            test(sample.getKey() == "k" + to_string(i % 3));
+            test(sample.getValue() == i);
+        }
+    }
+}
+
+void ::Writer::run(int argc, char* argv[])
+{
+    Node node(argc, argv);
+
+    Topic<string, string> controlTopic(node, "control");
+    auto control = makeSingleKeyWriter(controlTopic, "control");
+
+    Topic<string, string> doneTopic(node, "done");
+    auto done = makeSingleKeyReader(doneTopic, "done");
+
+    const filesystem::path dbPath = "db";
+    filesystem::remove_all(dbPath);
+    filesystem::create_directory(dbPath);
+
+    // The history node keeps at most 4 samples per writer in memory: the older samples are only in the database.
+    Ice::InitializationData initData;
+    initData.properties = node.getCommunicator()->getProperties()->clone();
+    initData.properties->setProperty("DataStorm.Node.LMDB.Path", dbPath.string());
+    initData.properties->setProperty("DataStorm.Topic.HistoryCacheSize", "4");
+    auto makeHistoryNode = [&initData]
+    {
+        Ice::CommunicatorHolder holder(initData);
+        Node historyNode(holder.communicator());
+        return pair{std::move(holder), std::move(historyNode)};
+    };
+
+    optional<pair<Ice::CommunicatorHolder, Node>> history;
+    try
+    {
+        history.emplace(makeHistoryNode());
+    }
+    catch (const std::invalid_argument&)
+    {
+        cout << "skipped, DataStorm is built without LMDB support" << endl;
+        control.add("skip");
+        test(done.getNextUnread().getValue() == "done");
+        return;
+    }
+
+    const WriterConfig config(-1, nullopt, ClearHistoryPolicy::Never);
+    const int count = 10;
+
+    cout << "testing any-key writer history... " << flush;
+    {
+        Topic<string, int> topic(history->second, "history");
+        {
+            auto writer = makeAnyKeyWriter(topic, "writer", config);
+            for (int i = 0; i < count; ++i)
+            {
+                writer.update("k" + to_string(i % 3), i);
+            }
+            checkAnyKeyHistory(writer, count);
+        }
+
+        // A writer created again with the same name restores its history, with the key of each sample.
+        auto writer = makeAnyKeyWriter(topic, "writer", config);
+        checkAnyKeyHistory(writer, count);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing single-key writer history... " << flush;
+    {
+        Topic<string, int> topic(history->second, "single");
+        {
+            auto writer = makeSingleKeyWriter(topic, "key", "writer", config);
+            for (int i = 0; i < count; ++i)
+            {
+                writer.update(i);
+            }
+        }
+
+        auto writer = makeSingleKeyWriter(topic, "key", "writer", config);
+        auto samples = writer.getAll();
+        test(samples.size() == static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            const auto& sample = samples[static_cast<size_t>(i)];
+            test(sample.getKey() == "key");
+            test(sample.getValue() == i);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing history restored after a node restart... " << flush;
+    history.reset();
+    history.emplace(makeHistoryNode());
+    {
+        Topic<string, int> topic(history->second, "history");
+        auto writer = makeAnyKeyWriter(topic, "writer", config);
+        checkAnyKeyHistory(writer, count);
+        cout << "ok" << endl;
+
+        // The reader creates its reader once the history is published. It gets the stored samples evicted from
+        // memory as well as the cached samples.
+        cout << "testing late reader gets the stored history... " << flush;
+        control.add("ready");
+        test(done.getNextUnread().getValue() == "done");
+        cout << "ok" << endl;
+    }
+
+    history.reset();
+    filesystem::remove_all(dbPath);
+}
+
+DEFINE_TEST(::Writer)
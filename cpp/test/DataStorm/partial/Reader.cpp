@@ -5,6 +5,7 @@
 #include "TestHelper.h"
 
 #include <future>
+#include <map>
 
 using namespace DataStorm;
 using namespace std;
@@ -551,6 +552,43 @@ void ::Reader::run(int argc, char* argv[])
         test(sample.getValue()->lastAsk == 14.0f);
     }
 
+    // Partial updates published concurrently on the same writer are each resolved against the previous value: the
+    // reader receives the values in increasing order, without gaps.
+    Topic<string, int> concurrentTopic(node, "concurrentTopic");
+    concurrentTopic.setReaderDefaultConfig(config);
+    concurrentTopic.setUpdater<int>("add", [](int& value, int delta) { value += delta; });
+    {
+        auto reader = makeSingleKeyReader(concurrentTopic, "counter");
+
+        auto sample = reader.getNextUnread();
+        test(sample.getValue() == 0);
+        for (int i = 1; i <= 400; ++i)
+        {
+            sample = reader.getNextUnread();
+            test(sample.getEvent() == SampleEvent::PartialUpdate);
+            test(sample.getValue() == i);
+        }
+    }
+
+    // The samples published concurrently by several writers of the same topic all arrive, each writer's samples in
+    // the order it published them.
+    Topic<string, int> concurrentWritersTopic(node, "concurrentWritersTopic");
+    concurrentWritersTopic.setReaderDefaultConfig(config);
+    {
+        auto reader = makeAnyKeyReader(concurrentWritersTopic);
+        map<string, int> next;
+        for (int i = 0; i < 4 * 200; ++i)
+        {
+            auto sample = reader.getNextUnread();
+            test(sample.getEvent() == SampleEvent::Update);
+            test(sample.getValue() == next[sample.getKey()]++);
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            test(next["writer" + to_string(i)] == 200);
+        }
+    }
+
     // A full value that the Decoder rejects is dropped by every reader of the key on the node: each of them keeps the
     // value it had and resynchronizes on the next full value that decodes.
     Topic<string, Counter> decodeErrorTopic(node, "decodeErrorTopic");
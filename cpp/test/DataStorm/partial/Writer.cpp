@@ -8,6 +8,7 @@
 #include "TestHelper.h"
 
 #include <chrono>
+#include <future>
 #include <thread>
 
 using namespace DataStorm;
@@ -494,6 +495,68 @@ void ::Writer::run(int argc, char* argv[])
     }
     cout << "ok" << endl;
 
+    // Partial updates published concurrently by several threads on the same writer are serialized: each of them is
+    // resolved against the value published just before it, and the reader receives them in this order.
+    Topic<string, int> concurrentTopic(node, "concurrentTopic");
+    concurrentTopic.setWriterDefaultConfig(config);
+    concurrentTopic.setUpdater<int>("add", [](int& value, int delta) { value += delta; });
+    cout << "testing concurrent partial updates... " << flush;
+    {
+        auto writer = makeSingleKeyWriter(concurrentTopic, "counter");
+        writer.waitForReaders();
+        writer.add(0);
+
+        auto add = writer.partialUpdate<int>("add");
+        vector<future<void>> futures;
+        for (int i = 0; i < 4; ++i)
+        {
+            futures.push_back(async(
+                launch::async,
+                [&add]
+                {
+                    for (int j = 0; j < 100; ++j)
+                    {
+                        add(1);
+                    }
+                }));
+        }
+        for (auto& f : futures)
+        {
+            f.get();
+        }
+        writer.waitForNoReaders();
+    }
+    cout << "ok" << endl;
+
+    // Several writers of the same topic publish concurrently: the writers don't serialize their sends on the topic,
+    // and the reader receives all the samples of each writer, in the order the writer published them.
+    Topic<string, int> concurrentWritersTopic(node, "concurrentWritersTopic");
+    concurrentWritersTopic.setWriterDefaultConfig(config);
+    cout << "testing concurrent writers... " << flush;
+    {
+        vector<future<void>> futures;
+        for (int i = 0; i < 4; ++i)
+        {
+            futures.push_back(async(
+                launch::async,
+                [&concurrentWritersTopic, i]
+                {
+                    auto writer = makeSingleKeyWriter(concurrentWritersTopic, "writer" + to_string(i));
+                    writer.waitForReaders();
+                    for (int j = 0; j < 200; ++j)
+                    {
+                        writer.update(j);
+                    }
+                    writer.waitForNoReaders();
+                }));
+        }
+        for (auto& f : futures)
+        {
+            f.get();
+        }
+    }
+    cout << "ok" << endl;
+
     // A full value that the reader's Decoder rejects is dropped by every reader of the key on the node, and none of
     // them keeps it as the key's value: they all carry on with the value they had and resynchronize on the next full
     // value that decodes.
@@ -38,6 +38,51 @@ AttackClient::run(int argc, char** argv)
     auto session = router->createSession("userid", "abc123");
     cout << "ok" << endl;
 
+    cout << "testing routing table eviction... " << flush;
+    {
+        // Fill the routing table (its maximum size is 10) and use the oldest proxy: it gets a second chance when the
+        // next proxy is added, and the following proxy is evicted instead. The invocations go through fixed proxies
+        // bound to the router connection, which bypass the client-side router and don't re-add evicted proxies.
+        BackendPrx base(communicator, "evict:" + getTestEndpoint());
+        Ice::ObjectProxySeq proxies;
+        for (int i = 0; i < 10; ++i)
+        {
+            proxies.emplace_back(base->ice_identity(Ice::stringToIdentity("evict" + to_string(i))));
+        }
+        test(router->addProxies(proxies).empty());
+
+        auto connection = router->ice_getConnection();
+        auto fixed = [&](int i)
+        {
+            auto proxy = base->ice_identity<BackendPrx>(Ice::stringToIdentity("evict" + to_string(i)));
+            return proxy->ice_fixed(connection);
+        };
+
+        fixed(0)->ice_ping();
+
+        auto evicted = router->addProxies({base->ice_identity(Ice::stringToIdentity("evict10"))});
+        test(evicted.size() == 1);
+        test(evicted[0]->ice_getIdentity() == Ice::stringToIdentity("evict1"));
+
+        fixed(0)->ice_ping();
+        fixed(10)->ice_ping();
+        try
+        {
+            fixed(1)->ice_ping();
+            test(false);
+        }
+        catch (const Ice::ObjectNotExistException& ex)
+        {
+            test(ex.operation() == "ice_add_proxy");
+        }
+
+        // Without invocations, the proxies are evicted in the order they were added.
+        evicted = router->addProxies({base->ice_identity(Ice::stringToIdentity("evict11"))});
+        test(evicted.size() == 1);
+        test(evicted[0]->ice_getIdentity() == Ice::stringToIdentity("evict2"));
+    }
+    cout << "ok" << endl;
+
     cout << "making thousands of invocations on proxies... " << flush;
     BackendPrx backend(communicator, "dummy:" + getTestEndpoint());
     backend->ice_ping();
@@ -203,6 +203,24 @@ CallbackI::initiateCallbackWithPayloadAsync(
     proxy->callbackWithPayloadAsync(seq, std::move(response), std::move(error), nullptr, current.ctx);
 }
 
+void
+CallbackI::count(int number, const Ice::Current&)
+{
+    lock_guard lock(_mutex);
+    if (number != 1 && number != _count + 1)
+    {
+        _outOfOrder = true;
+    }
+    _count = number;
+}
+
+int
+CallbackI::getCount(const Ice::Current&)
+{
+    lock_guard lock(_mutex);
+    return _outOfOrder ? -1 : _count;
+}
+
 void
 CallbackI::shutdown(const Ice::Current& current)
 {
@@ -69,7 +69,15 @@ public:
         std::function<void(std::exception_ptr)>,
         const Ice::Current&) override;
 
+    void count(int, const Ice::Current&) override;
+    int getCount(const Ice::Current&) override;
+
     void shutdown(const Ice::Current&) override;
+
+private:
+    int _count = 0;
+    bool _outOfOrder = false;
+    std::mutex _mutex;
 };
 
 #endif
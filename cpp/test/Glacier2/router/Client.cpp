@@ -617,6 +617,47 @@ CallbackClient::run(int argc, char** argv)
         cout << "ok" << endl;
     }
 
+    //
+    // Send many oneway requests without waiting: with Glacier2.Client/Server.BatchInterval set, the router forwards
+    // them and the resulting callbacks as batches, and none of them must be lost.
+    //
+    {
+        cout << "testing many oneway callbacks... " << flush;
+        auto oneway = twoway->ice_oneway();
+        auto onewayR = twowayR->ice_oneway();
+        Context context;
+        context["_fwd"] = "o";
+        vector<future<void>> sent;
+        for (int i = 0; i < 200; ++i)
+        {
+            sent.push_back(oneway->initiateCallbackAsync(onewayR, context));
+        }
+        for (auto& f : sent)
+        {
+            f.get();
+        }
+        callbackReceiver->callbackOK(200);
+        cout << "ok" << endl;
+    }
+
+    //
+    // A twoway request must not overtake the oneway requests sent before it on the same connection, even when the
+    // router forwards these oneway requests as batches.
+    //
+    {
+        cout << "testing ordering of oneway and twoway requests... " << flush;
+        auto oneway = twoway->ice_oneway();
+        for (int i = 1; i <= 100; ++i)
+        {
+            oneway->count(i);
+            if (i % 10 == 0)
+            {
+                test(twoway->getCount() == i);
+            }
+        }
+        cout << "ok" << endl;
+    }
+
     //
     // Send 3 twoway requests to callback the receiver. The callback
     // receiver only replies to the callback once it has received the 3
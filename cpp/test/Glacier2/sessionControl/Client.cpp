@@ -7,6 +7,7 @@
 
 #include <chrono>
 #include <future>
+#include <set>
 
 using namespace std;
 using namespace Ice;
@@ -80,6 +81,45 @@ SessionControlClient::run(int argc, char** argv)
     }
     cout << "ok" << endl;
 
+    cout << "testing concurrent sessions... " << flush;
+    {
+        // Each client has its own connection to the router, and therefore its own session and category.
+        const int nClients = 20;
+        const string routerProxy = "Glacier2/router:" + getTestEndpoint(50);
+        vector<string> categories(nClients);
+        vector<future<void>> futures;
+        for (int i = 0; i < nClients; ++i)
+        {
+            futures.push_back(std::async(
+                launch::async,
+                [&categories, &routerProxy, properties, i]
+                {
+                    Ice::InitializationData initData;
+                    initData.properties = properties->clone();
+                    Ice::CommunicatorHolder clientHolder(initData);
+                    Glacier2::RouterPrx clientRouter(clientHolder.communicator(), routerProxy);
+                    clientHolder.communicator()->setDefaultRouter(clientRouter);
+
+                    auto clientSession =
+                        uncheckedCast<Test::SessionPrx>(clientRouter->createSession("userid", "abc123"));
+                    test(clientSession);
+                    categories[i] = clientRouter->getCategoryForClient();
+                    for (int j = 0; j < 10; ++j)
+                    {
+                        clientSession->ice_ping();
+                        test(clientRouter->getCategoryForClient() == categories[i]);
+                    }
+                    clientRouter->destroySession();
+                }));
+        }
+        for (auto& f : futures)
+        {
+            f.get();
+        }
+        test(set<string>(categories.begin(), categories.end()).size() == categories.size());
+    }
+    cout << "ok" << endl;
+
     cout << "testing shutdown... " << flush;
     session = uncheckedCast<Test::SessionPrx>(router->createSession("userid", "abc123"));
     session->shutdown();
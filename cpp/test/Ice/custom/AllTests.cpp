@@ -148,6 +148,14 @@ allTests(TestHelper* helper)
         test(ret == in);
     }
 
+    {
+        string in = "A STRING UNMARSHALED AS A VIEW";
+        string out;
+        string ret = t->opStringView(in, out);
+        test(out == in);
+        test(ret == in);
+    }
+
     {
         deque<bool> in(5);
         in[0] = false;
@@ -630,6 +638,13 @@ allTests(TestHelper* helper)
             test(std::get<0>(r) == in);
         }
 
+        {
+            string in = "A STRING UNMARSHALED AS A VIEW";
+            auto r = t->opStringViewAsync(in).get();
+            test(std::get<1>(r) == in);
+            test(std::get<0>(r) == in);
+        }
+
         {
             deque<bool> in(5);
             in[0] = false;
@@ -1046,6 +1061,23 @@ allTests(TestHelper* helper)
         test(done.get_future().get());
     }
 
+    {
+        string in = "A STRING UNMARSHALED AS A VIEW";
+        promise<bool> done;
+
+        t->opStringViewAsync(
+            in,
+            [&](string_view ret, string_view out)
+            {
+                test(out == in);
+                test(ret == in);
+                done.set_value(true);
+            },
+            [&](std::exception_ptr) { done.set_value(false); });
+
+        test(done.get_future().get());
+    }
+
     {
         deque<bool> in(5);
         in[0] = false;
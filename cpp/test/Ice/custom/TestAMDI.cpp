@@ -72,6 +72,16 @@ TestIntfI::opVariableArrayAsync(
     response(in, in);
 }
 
+void
+TestIntfI::opStringViewAsync(
+    string_view in,
+    function<void(string_view, string_view)> response,
+    function<void(exception_ptr)>,
+    const Current&)
+{
+    response(in, in);
+}
+
 void
 TestIntfI::opBoolSeqAsync(
     deque<bool> in,
@@ -44,6 +44,12 @@ public:
         std::function<void(std::exception_ptr)>,
         const Ice::Current&) override;
 
+    void opStringViewAsync(
+        std::string_view,
+        std::function<void(std::string_view, std::string_view)>,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) override;
+
     void opBoolSeqAsync(
         std::deque<bool>,
         std::function<void(const std::deque<bool>&, const std::deque<bool>&)>,
@@ -58,6 +58,13 @@ TestIntfI::opVariableArray(pair<const Variable*, const Variable*> inSeq, Variabl
     return outSeq;
 }
 
+string
+TestIntfI::opStringView(string_view inS, string& outS, const Current&)
+{
+    outS = string{inS};
+    return outS;
+}
+
 deque<bool>
 TestIntfI::opBoolSeq(deque<bool> inSeq, deque<bool>& outSeq, const Current&)
 {
@@ -24,6 +24,8 @@ public:
         Test::VariableList&,
         const Ice::Current&) final;
 
+    std::string opStringView(std::string_view, std::string&, const Ice::Current&) final;
+
     std::deque<bool> opBoolSeq(std::deque<bool>, std::deque<bool>&, const Ice::Current&) final;
 
     std::list<bool> opBoolList(std::list<bool>, std::list<bool>&, const Ice::Current&) final;
@@ -0,0 +1,158 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    // The path of the Unix domain socket of a shm endpoint, see IceInternal::shmSocketPath.
+    string socketPath(const string& name)
+    {
+        const char* tmpdir = getenv("TMPDIR");
+        string path = tmpdir && *tmpdir ? tmpdir : "/tmp";
+        if (path.back() != '/')
+        {
+            path += '/';
+        }
+        return path + "ice-shm-" + to_string(geteuid()) + "/" + name;
+    }
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+
+    cout << "testing shm endpoint parsing... " << flush;
+    {
+        Ice::ObjectPrx prx(communicator, "test:shm -n foo -z");
+        auto info = prx->ice_getEndpoints()[0]->getInfo();
+        test(info->type() == Ice::SHMEndpointType);
+        test(info->compress);
+        test(prx->ice_getEndpoints()[0]->toString() == "shm -n foo -z");
+
+        for (const string& endpoint : {"shm", "shm -n", "shm -n a/b", "shm -n ../x"})
+        {
+            try
+            {
+                Ice::ObjectPrx(communicator, "test:" + endpoint);
+                test(false);
+            }
+            catch (const Ice::ParseException&)
+            {
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing unmarshaling of invalid shm endpoints... " << flush;
+    {
+        // An shm endpoint with the name "../x", as a peer could send it.
+        try
+        {
+            Ice::ObjectPrx(communicator, "test:opaque -t 10 -e 1.1 -v BC4uL3gA");
+            test(false);
+        }
+        catch (const Ice::MarshalException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing that the adapter doesn't remove files which are not sockets... " << flush;
+    {
+        const string name = "test-" + to_string(helper->getTestPort(1));
+        const string path = socketPath(name);
+        {
+            ofstream file(path);
+            file << "not a socket";
+        }
+
+        communicator->getProperties()->setProperty("NotASocketAdapter.Endpoints", "shm -n " + name);
+        try
+        {
+            communicator->createObjectAdapter("NotASocketAdapter");
+            test(false);
+        }
+        catch (const Ice::SocketException&)
+        {
+        }
+
+        struct stat st;
+        test(::stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode));
+        ::remove(path.c_str());
+    }
+    cout << "ok" << endl;
+
+    TestIntfPrx obj(communicator, "test:" + helper->getTestEndpoint(0, "shm"));
+
+    cout << "testing shm connection... " << flush;
+    {
+        obj->ice_ping();
+        Ice::ConnectionPtr connection = obj->ice_getConnection();
+        test(connection->getEndpoint()->getInfo()->type() == Ice::SHMEndpointType);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing shm socket permissions... " << flush;
+    {
+        // The endpoint string is "shm -n <name>".
+        const string endpoint = obj->ice_getEndpoints()[0]->toString();
+        const string path = socketPath(endpoint.substr(endpoint.rfind(' ') + 1));
+
+        struct stat st;
+        test(::lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode));
+        test((st.st_mode & (S_IRWXG | S_IRWXO)) == 0);
+
+        const string directory = path.substr(0, path.rfind('/'));
+        test(::lstat(directory.c_str(), &st) == 0 && S_ISDIR(st.st_mode));
+        test(st.st_uid == ::geteuid());
+        test((st.st_mode & (S_IRWXG | S_IRWXO)) == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing requests of different sizes... " << flush;
+    {
+        // The ring buffers hold 1MB: repeated requests wrap around, and larger requests are sent in several chunks.
+        for (size_t size : {size_t{0}, size_t{1}, size_t{1024}, size_t{300 * 1024}, size_t{3 * 1024 * 1024}})
+        {
+            ByteSeq seq(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                seq[i] = static_cast<byte>(i % 251);
+            }
+
+            for (int i = 0; i < 10; ++i)
+            {
+                test(obj->echo(seq) == seq);
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing concurrent requests... " << flush;
+    {
+        ByteSeq seq(64 * 1024, byte{42});
+        vector<future<ByteSeq>> results;
+        for (int i = 0; i < 100; ++i)
+        {
+            results.push_back(obj->echoAsync(seq));
+        }
+        for (auto& result : results)
+        {
+            test(result.get() == seq);
+        }
+    }
+    cout << "ok" << endl;
+
+    obj->shutdown();
+}
@@ -0,0 +1,27 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::InitializationData initData;
+    initData.properties = createTestProperties(argc, argv);
+    initData.properties->setProperty("Ice.MessageSizeMax", "8192");
+    initData.pluginFactories = {Ice::shmPluginFactory()};
+
+    Ice::CommunicatorHolder communicator = initialize(initData);
+    void allTests(Test::TestHelper*);
+    allTests(this);
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,32 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Server : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Server::run(int argc, char** argv)
+{
+    Ice::InitializationData initData;
+    initData.properties = createTestProperties(argc, argv);
+    initData.properties->setProperty("Ice.MessageSizeMax", "8192");
+    initData.pluginFactories = {Ice::shmPluginFactory()};
+
+    Ice::CommunicatorHolder communicator = initialize(initData);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint(0, "shm"));
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(std::make_shared<TestI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+    serverReady();
+    communicator->waitForShutdown();
+}
+
+DEFINE_TEST(Server)
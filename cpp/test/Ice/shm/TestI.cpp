@@ -0,0 +1,18 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+#include "Ice/Ice.h"
+
+using namespace std;
+
+Test::ByteSeq
+TestI::echo(Test::ByteSeq seq, const Ice::Current&)
+{
+    return seq;
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,15 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestI final : public Test::TestIntf
+{
+public:
+    Test::ByteSeq echo(Test::ByteSeq, const Ice::Current&) final;
+    void shutdown(const Ice::Current&) final;
+};
+
+#endif
@@ -327,6 +327,27 @@ allTests(Test::TestHelper* helper, const CustomSliceLoaderPtr& customSliceLoader
         test(arr2S == arrS);
     }
 
+    {
+        // Any non-zero byte is read as true, including with the array mapping.
+        Ice::ByteSeq bytes{byte{0}, byte{1}, byte{2}, byte{0}, byte{0xff}};
+        bytes.insert(bytes.end(), {byte{0}, byte{1}, byte{0}, byte{0x10}, byte{1}});
+        Ice::OutputStream out(communicator);
+        out.writeSize(static_cast<int32_t>(bytes.size()));
+        out.writeBlob(bytes);
+        out.finished(data);
+
+        Ice::BoolSeq expected{false, true, true, false, true, false, true, false, true, true};
+        Ice::InputStream in(communicator, data);
+        Ice::BoolSeq arr;
+        in.read(arr);
+        test(arr == expected);
+
+        Ice::InputStream in2(communicator, data);
+        pair<const bool*, const bool*> arr2;
+        in2.read(arr2);
+        test(Ice::BoolSeq(arr2.first, arr2.second) == expected);
+    }
+
     {
         Ice::ByteSeq arr;
         arr.push_back(byte{0x01});
@@ -609,6 +630,44 @@ allTests(Test::TestHelper* helper, const CustomSliceLoaderPtr& customSliceLoader
         in2.read(arr2S);
     }
 
+    {
+        // A sequence of structs whose memory layout is their Slice encoding is marshaled with a single copy: check the
+        // encoding is the same as marshaling the structs field by field.
+        test(Ice::HasWireLayout<Point>::value || !Ice::nativeLittleEndian);
+        PointS arr;
+        for (int i = 0; i < 4; ++i)
+        {
+            Point point;
+            point.x = i;
+            point.y = -i;
+            arr.push_back(point);
+        }
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.finished(data);
+
+        Ice::OutputStream expected(communicator);
+        expected.writeSize(static_cast<int32_t>(arr.size()));
+        for (const auto& point : arr)
+        {
+            expected.write(point.x);
+            expected.write(point.y);
+        }
+        Ice::ByteSeq expectedData;
+        expected.finished(expectedData);
+        test(data == expectedData);
+
+        Ice::InputStream in(communicator, data);
+        PointS arr2;
+        in.read(arr2);
+        test(arr2 == arr);
+
+        Ice::InputStream in2(communicator, data);
+        pair<const Point*, const Point*> arr3;
+        in2.read(arr3);
+        test(PointS(arr3.first, arr3.second) == arr);
+    }
+
     {
         MyClassS arr;
         for (int i = 0; i < 4; ++i)
@@ -5,7 +5,13 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 
 using namespace std;
@@ -87,6 +93,62 @@ private:
     condition_variable _condVar;
 };
 
+// Records the states published to the node observers for each server.
+class NodeObserverI final : public IceGrid::NodeObserver
+{
+public:
+    void nodeInit(IceGrid::NodeDynamicInfoSeq, const Ice::Current&) override {}
+
+    void nodeUp(IceGrid::NodeDynamicInfo, const Ice::Current&) override {}
+
+    void nodeDown(string, const Ice::Current&) override {}
+
+    void updateServer(string, IceGrid::ServerDynamicInfo info, const Ice::Current&) override
+    {
+        lock_guard lock(_mutex);
+        _states[info.id].push_back(info.state);
+        _updates.push_back(info.id);
+        _condVar.notify_all();
+    }
+
+    void updateAdapter(string, IceGrid::AdapterDynamicInfo info, const Ice::Current&) override
+    {
+        if (info.proxy)
+        {
+            lock_guard lock(_mutex);
+            _updates.push_back(info.id);
+        }
+    }
+
+    // Returns the IDs of the updated servers and registered adapters, in the order the updates were received.
+    vector<string> getUpdates()
+    {
+        lock_guard lock(_mutex);
+        return _updates;
+    }
+
+    // Waits until the given state is published for the server, and returns the states published for the server
+    // since the previous call.
+    vector<IceGrid::ServerState> waitForState(const string& server, IceGrid::ServerState state)
+    {
+        unique_lock lock(_mutex);
+        auto& states = _states[server];
+        test(_condVar.wait_for(
+            lock,
+            chrono::seconds(30),
+            [&states, state] { return !states.empty() && states.back() == state; }));
+        vector<IceGrid::ServerState> published;
+        published.swap(states);
+        return published;
+    }
+
+private:
+    map<string, vector<IceGrid::ServerState>> _states;
+    vector<string> _updates;
+    mutex _mutex;
+    condition_variable _condVar;
+};
+
 void
 allTests(Test::TestHelper* helper)
 {
@@ -786,6 +848,148 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing concurrent activation... " << flush;
+    {
+        // The node activates at most IceGrid.Node.ConcurrentActivations servers at a time (2 with this test
+        // configuration), a server holds its activation slot until it's active. A failed activation must not prevent
+        // the other servers from being activated.
+        IceGrid::ApplicationInfo info = admin->getApplicationInfo("Test");
+        IceGrid::ApplicationDescriptor testApp;
+        testApp.name = "TestApp";
+        testApp.serverTemplates = info.descriptor.serverTemplates;
+        testApp.variables = info.descriptor.variables;
+        const int nServers = 6;
+        for (int i = 0; i < nServers; ++i)
+        {
+            IceGrid::ServerInstanceDescriptor server;
+            server.templateName = "Server";
+            server.parameterValues["id"] = "concurrent-" + to_string(i);
+            server.parameterValues["activation-delay"] = "1";
+            testApp.nodes["localnode"].serverInstances.push_back(server);
+        }
+        auto invalid = make_shared<IceGrid::ServerDescriptor>();
+        invalid->id = "concurrent-invalid-exe";
+        invalid->exe = "./server2";
+        invalid->activation = "manual";
+        invalid->propertySet.properties.push_back(IceGrid::PropertyDescriptor{"Ice.Admin.Endpoints", ""});
+        testApp.nodes["localnode"].servers.push_back(invalid);
+        try
+        {
+            admin->addApplication(testApp);
+        }
+        catch (const IceGrid::DeploymentException& ex)
+        {
+            cerr << ex.reason << endl;
+            test(false);
+        }
+
+        auto start = chrono::steady_clock::now();
+        auto invalidStarted = admin->startServerAsync("concurrent-invalid-exe");
+        vector<future<void>> started;
+        mutex activatedMutex;
+        vector<chrono::steady_clock::duration> activated;
+        for (int i = 0; i < nServers; ++i)
+        {
+            auto promise = make_shared<std::promise<void>>();
+            started.push_back(promise->get_future());
+            admin->startServerAsync(
+                "concurrent-" + to_string(i),
+                [promise, start, &activatedMutex, &activated]
+                {
+                    {
+                        lock_guard lock(activatedMutex);
+                        activated.push_back(chrono::steady_clock::now() - start);
+                    }
+                    promise->set_value();
+                },
+                [promise](exception_ptr ex) { promise->set_exception(ex); });
+        }
+        try
+        {
+            invalidStarted.get();
+            test(false);
+        }
+        catch (const IceGrid::ServerStartException&)
+        {
+        }
+
+        set<int> pids;
+        for (int i = 0; i < nServers; ++i)
+        {
+            const string id = "concurrent-" + to_string(i);
+            try
+            {
+                started[static_cast<size_t>(i)].get();
+            }
+            catch (const IceGrid::ServerStartException& ex)
+            {
+                cerr << ex.reason << endl;
+                test(false);
+            }
+            test(admin->getServerState(id) == IceGrid::ServerState::Active);
+            pids.insert(admin->getServerPid(id));
+        }
+        test(pids.size() == static_cast<size_t>(nServers));
+
+        // Each server waits 1s before activating its object adapter. With at most 2 servers activating at a time,
+        // the servers become active in pairs, at least 1s after the previous pair.
+        sort(activated.begin(), activated.end());
+        for (size_t i = 0; i < activated.size(); ++i)
+        {
+            test(activated[i] >= chrono::seconds(static_cast<int>(i / 2) + 1));
+        }
+
+        for (int i = 0; i < nServers; ++i)
+        {
+            admin->stopServer("concurrent-" + to_string(i));
+        }
+        admin->removeApplication("TestApp");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing node observer update period... " << flush;
+    {
+        // The registry publishes the server and adapter updates to the node observers at the end of each
+        // IceGrid.Registry.NodeObserverUpdatePeriod (2s with this test configuration), and only the last update of
+        // each server or adapter.
+        auto start = chrono::steady_clock::now();
+        auto adapter = communicator->createObjectAdapter("");
+        auto observer = make_shared<NodeObserverI>();
+        auto proxy = adapter->addWithUUID(observer);
+        adapter->activate();
+        adminSession->ice_getConnection()->setAdapter(adapter);
+        adminSession->setObserversByIdentity(
+            Ice::Identity(),
+            proxy->ice_getIdentity(),
+            Ice::Identity(),
+            Ice::Identity(),
+            Ice::Identity());
+
+        // Each cycle goes through the Activating, Active, Deactivating and Inactive states. The flushes are at least
+        // one period apart, so the observer can't receive more server updates than the number of periods elapsed
+        // since it subscribed (plus one for the first flush), however slow the cycles are.
+        const int cycles = 5;
+        for (int i = 0; i < cycles; ++i)
+        {
+            admin->startServer("server-manual");
+            admin->stopServer("server-manual");
+        }
+        test(admin->getServerState("server-manual") == IceGrid::ServerState::Inactive);
+
+        auto states = observer->waitForState("server-manual", IceGrid::ServerState::Inactive);
+        auto periods = (chrono::steady_clock::now() - start) / chrono::seconds(2);
+        test(states.size() <= static_cast<size_t>(periods) + 1);
+
+        // The server state changes to Activating before its adapter is registered: the coalesced updates are
+        // published in the order they were first received, so a server update comes before the adapter registration.
+        auto updates = observer->getUpdates();
+        auto server = find(updates.begin(), updates.end(), "server-manual");
+        auto serverAdapter = find(updates.begin(), updates.end(), "server-manual.TestAdapter");
+        test(server != updates.end());
+        test(server < serverAdapter);
+    }
+    cout << "ok" << endl;
+
     admin->stopServer("node-1");
     admin->stopServer("node-2");
 
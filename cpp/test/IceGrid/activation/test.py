@@ -2,7 +2,7 @@
 import os
 import re
 
-from IceGridUtil import IceGridNode, IceGridTestCase
+from IceGridUtil import IceGridNode, IceGridRegistryMaster, IceGridTestCase
 from Util import TestSuite, Windows, platform
 
 outfilters = [
@@ -15,6 +15,11 @@ outfilters = [
 if isinstance(platform, Windows) or os.getuid() != 0:
     TestSuite(
         __file__,
-        [IceGridTestCase(icegridnode=IceGridNode(outfilters=outfilters))],
+        [
+            IceGridTestCase(
+                icegridregistry=[IceGridRegistryMaster(props={"IceGrid.Registry.NodeObserverUpdatePeriod": 2000})],
+                icegridnode=IceGridNode(outfilters=outfilters, props={"IceGrid.Node.ConcurrentActivations": 2}),
+            )
+        ],
         multihost=False,
     )
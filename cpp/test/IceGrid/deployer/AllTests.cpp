@@ -6,6 +6,7 @@
 #include "TestHelper.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <fstream>
 
 using namespace std;
@@ -349,6 +350,115 @@ logTests(const shared_ptr<Ice::Communicator>& comm, const optional<AdminSessionP
     cout << "ok" << endl;
 }
 
+void
+logIndexTests(const shared_ptr<Ice::Communicator>& comm, const optional<AdminSessionPrx>& session)
+{
+    cout << "testing log file line index... " << flush;
+    string testDir = comm->getProperties()->getProperty("TestDir");
+    optional<AdminPrx> admin = session->getAdmin();
+
+    auto writeLines = [](const string& path, const string& prefix, int first, int count, bool append = false)
+    {
+        ofstream os(path.c_str(), append ? ios_base::app : ios_base::trunc);
+        for (int i = first; i < first + count; ++i)
+        {
+            os << prefix << ' ' << i << '\n';
+        }
+    };
+
+    // Reads the last count lines of the log, which must be the lines prefix first, prefix first + 1, etc.
+    auto checkLastLines = [&session](const string& path, int count, const string& prefix, int first)
+    {
+        auto it = session->openServerLog("LogIndexServer", path, count);
+        Ice::StringSeq lines;
+        test(it->read(1024 * 1024, lines));
+        it->destroy();
+        test(lines.size() == static_cast<size_t>(count) + 1 && lines.back().empty());
+        for (int i = 0; i < count; ++i)
+        {
+            test(lines[static_cast<size_t>(i)] == prefix + ' ' + to_string(first + i));
+        }
+    };
+
+    // A server with the log files of this test, which are indexed by the node when the last lines are requested.
+    ApplicationInfo info = admin->getApplicationInfo("Test");
+    ApplicationDescriptor logApp;
+    logApp.name = "LogIndexApp";
+    logApp.variables = info.descriptor.variables;
+    for (const auto& [nodeName, node] : info.descriptor.nodes)
+    {
+        for (const auto& server : node.servers)
+        {
+            if (server->id == "LogServer")
+            {
+                auto logServer = dynamic_pointer_cast<ServerDescriptor>(server->ice_clone());
+                logServer->id = "LogIndexServer";
+                logServer->logs = {"${server.dir}/index.txt"};
+                for (int i = 0; i <= 64; ++i)
+                {
+                    logServer->logs.push_back("${server.dir}/lru" + to_string(i) + ".txt");
+                }
+                logApp.nodes[nodeName].servers.push_back(logServer);
+            }
+        }
+    }
+    test(logApp.nodes.size() == 1);
+    admin->addApplication(logApp);
+
+    try
+    {
+        // The index has one offset every 64 lines: the requests cross these offsets as the file grows.
+        const string path = testDir + "/index.txt";
+        writeLines(path, "line", 0, 200);
+        checkLastLines(path, 10, "line", 190);
+        checkLastLines(path, 200, "line", 0);
+        writeLines(path, "line", 200, 100, true);
+        checkLastLines(path, 150, "line", 150);
+        checkLastLines(path, 1, "line", 299);
+
+        // A truncated file is indexed again.
+        writeLines(path, "truncated", 0, 70);
+        checkLastLines(path, 5, "truncated", 65);
+        checkLastLines(path, 70, "truncated", 0);
+
+        // So is a file rewritten with the same size but a different content.
+        writeLines(path, "TRUNCATED", 0, 70);
+        checkLastLines(path, 66, "TRUNCATED", 4);
+
+        // And a file replaced by a new one, as with a log rotation.
+        test(::rename(path.c_str(), (path + ".1").c_str()) == 0);
+        writeLines(path, "rotated", 0, 100);
+        checkLastLines(path, 2, "rotated", 98);
+        writeLines(path, "rotated", 100, 30, true);
+        checkLastLines(path, 65, "rotated", 65);
+        ::remove((path + ".1").c_str());
+
+        // The node indexes at most 64 files: the index of the least recently used file is evicted, and rebuilt when
+        // the file is read again.
+        for (int i = 0; i <= 64; ++i)
+        {
+            const string lruPath = testDir + "/lru" + to_string(i) + ".txt";
+            writeLines(lruPath, "lru" + to_string(i), 0, 100);
+            checkLastLines(lruPath, 1, "lru" + to_string(i), 99);
+        }
+        for (int i = 0; i <= 64; ++i)
+        {
+            const string lruPath = testDir + "/lru" + to_string(i) + ".txt";
+            checkLastLines(lruPath, 70, "lru" + to_string(i), 30);
+            ::remove(lruPath.c_str());
+        }
+        ::remove(path.c_str());
+    }
+    catch (const FileNotAvailableException& ex)
+    {
+        cerr << ex.reason << endl;
+        test(false);
+    }
+
+    admin->removeApplication("LogIndexApp");
+    cout << "ok" << endl;
+}
+
 void
 allTests(Test::TestHelper* helper)
 {
@@ -710,6 +820,7 @@ allTests(Test::TestHelper* helper)
     cout << "ok" << endl;
 
     logTests(comm, session);
+    logIndexTests(comm, session);
 
     session->destroy();
 }
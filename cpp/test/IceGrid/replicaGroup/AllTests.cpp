@@ -6,6 +6,7 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <algorithm>
 #include <chrono>
 #include <set>
 #include <thread>
@@ -483,6 +484,65 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing replication with live adaptive load balancing... " << flush;
+    {
+        map<string, string> params;
+        params["replicaGroup"] = "Adaptive-Live";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["replicaGroup"] = "Adaptive";
+        params["id"] = "Server3";
+        instantiateServer(admin, "Server", "localnode", params);
+
+        TestIntfPrx obj(comm, "Adaptive-Live");
+        obj = obj->ice_locatorCacheTimeout(0);
+        obj = obj->ice_connectionCached(false);
+        for (int i = 0; i < 10; ++i)
+        {
+            string replicaId = obj->getReplicaId();
+            test(replicaId == "Server1.ReplicatedAdapter" || replicaId == "Server2.ReplicatedAdapter");
+        }
+
+        // Load Server1 with dispatches in progress: once the node reported the live load of both replicas, the
+        // replica group resolves to the least loaded replica, Server2. Server1 holds two dispatches while the client
+        // makes one request at a time, so Server2 always has fewer dispatches in progress.
+        TestIntfPrx(comm, "Server2")->ice_ping();
+        TestIntfPrx server1(comm, "Server1");
+        auto dispatch1 = server1->startDispatchAsync();
+        auto dispatch2 = server1->startDispatchAsync();
+        int nRetry = 0;
+        while (obj->getReplicaId() != "Server2.ReplicatedAdapter" && nRetry++ < 100)
+        {
+            this_thread::sleep_for(chrono::milliseconds(100));
+        }
+        for (int i = 0; i < 10; ++i)
+        {
+            test(obj->getReplicaId() == "Server2.ReplicatedAdapter");
+        }
+        server1->finishDispatches();
+        dispatch1.get();
+        dispatch2.get();
+
+        // Only the servers with an adapter in a replica group with the live load sample enable the dispatch metrics
+        // view sampled by the node.
+        auto getGroupBy = [&admin](const string& id)
+        {
+            return admin->getServerAdmin(id)
+                ->ice_facet<Ice::PropertiesAdminPrx>("Properties")
+                ->getProperty("IceMX.Metrics.IceGridLiveLoad.Map.Dispatch.GroupBy");
+        };
+        test(getGroupBy("Server1") == "parent");
+        test(getGroupBy("Server2") == "parent");
+        test(getGroupBy("Server3").empty());
+
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+    }
+    cout << "ok" << endl;
+
     cout << "testing filters... " << flush;
     {
         map<string, string> params;
@@ -967,6 +1027,85 @@ allTests(Test::TestHelper* helper)
     };
     cout << "ok" << endl;
 
+    cout << "testing object queries... " << flush;
+    {
+        auto createReplicaGroup = [](const string& id, const vector<pair<string, string>>& objects)
+        {
+            ReplicaGroupDescriptor replicaGroup;
+            replicaGroup.id = id;
+            replicaGroup.loadBalancing = make_shared<RandomLoadBalancingPolicy>("0");
+            for (const auto& [identity, type] : objects)
+            {
+                ObjectDescriptor object;
+                object.id = Ice::stringToIdentity(identity);
+                object.type = type;
+                replicaGroup.objects.push_back(object);
+            }
+            return replicaGroup;
+        };
+
+        auto getIds = [comm](const ObjectInfoSeq& infos)
+        {
+            vector<string> ids;
+            for (const auto& info : infos)
+            {
+                ids.push_back(comm->identityToString(info.proxy->ice_getIdentity()));
+            }
+            return ids;
+        };
+
+        ApplicationDescriptor app;
+        app.name = "ObjectQueries";
+        app.replicaGroups.push_back(createReplicaGroup(
+            "QueryRG1",
+            {{"query/foo-1", "::Test::Foo"}, {"query/foo-2", "::Test::Foo"}, {"query/bar-1", "::Test::Bar"}}));
+        app.replicaGroups.push_back(createReplicaGroup("QueryRG2", {{"query/foo-3", "::Test::Foo"}}));
+        admin->addApplication(app);
+
+        // Expression with a prefix and a trailing wildcard.
+        test(
+            getIds(admin->getAllObjectInfos("query/foo*")) ==
+            vector<string>({"query/foo-1", "query/foo-2", "query/foo-3"}));
+        // Expression with a wildcard within the identity.
+        test(getIds(admin->getAllObjectInfos("query/*-1")) == vector<string>({"query/bar-1", "query/foo-1"}));
+        // Expression without wildcard.
+        test(getIds(admin->getAllObjectInfos("query/foo-2")) == vector<string>({"query/foo-2"}));
+        test(admin->getAllObjectInfos("query/foo").empty());
+        test(admin->getAllObjectInfos("unknown*").empty());
+        // Empty expression, all the objects.
+        auto all = getIds(admin->getAllObjectInfos(""));
+        test(count_if(all.begin(), all.end(), [](const string& id) { return id.find("query/") == 0; }) == 4);
+
+        test(getIds(admin->getObjectInfosByType("::Test::Foo")) ==
+             vector<string>({"query/foo-1", "query/foo-2", "query/foo-3"}));
+        test(getIds(admin->getObjectInfosByType("::Test::Bar")) == vector<string>({"query/bar-1"}));
+        test(query->findAllObjectsByType("::Test::Foo").size() == 3);
+
+        // Reload the application: remove query/foo-2, add query/bar-2 and remove QueryRG2 with query/foo-3.
+        ApplicationUpdateDescriptor update;
+        update.name = "ObjectQueries";
+        update.replicaGroups.push_back(createReplicaGroup(
+            "QueryRG1",
+            {{"query/foo-1", "::Test::Foo"}, {"query/bar-1", "::Test::Bar"}, {"query/bar-2", "::Test::Bar"}}));
+        update.removeReplicaGroups.emplace_back("QueryRG2");
+        admin->updateApplication(update);
+
+        test(getIds(admin->getObjectInfosByType("::Test::Foo")) == vector<string>({"query/foo-1"}));
+        test(getIds(admin->getObjectInfosByType("::Test::Bar")) == vector<string>({"query/bar-1", "query/bar-2"}));
+        test(query->findAllObjectsByType("::Test::Bar").size() == 2);
+        test(getIds(admin->getAllObjectInfos("query/*")) ==
+             vector<string>({"query/bar-1", "query/bar-2", "query/foo-1"}));
+        test(admin->getAllObjectInfos("query/foo-2").empty());
+
+        admin->removeApplication("ObjectQueries");
+
+        test(admin->getObjectInfosByType("::Test::Foo").empty());
+        test(admin->getObjectInfosByType("::Test::Bar").empty());
+        test(query->findAllObjectsByType("::Test::Bar").empty());
+        test(admin->getAllObjectInfos("query/*").empty());
+    }
+    cout << "ok" << endl;
+
     cout << "testing replica group with different server encoding support... " << flush;
     {
         vector<string> loadBalancings;
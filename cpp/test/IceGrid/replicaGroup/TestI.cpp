@@ -17,3 +17,24 @@ TestI::getReplicaIdAndShutdown(const Ice::Current& current)
     current.adapter->getCommunicator()->shutdown();
     return _properties->getProperty(current.adapter->getName() + ".AdapterId");
 }
+
+void
+TestI::startDispatchAsync(std::function<void()> response, std::function<void(std::exception_ptr)>, const Ice::Current&)
+{
+    std::lock_guard lock(_mutex);
+    _pending.push_back(std::move(response));
+}
+
+void
+TestI::finishDispatches(const Ice::Current&)
+{
+    std::vector<std::function<void()>> pending;
+    {
+        std::lock_guard lock(_mutex);
+        pending.swap(_pending);
+    }
+    for (const auto& response : pending)
+    {
+        response();
+    }
+}
@@ -5,6 +5,10 @@
 
 #include "Test.h"
 
+#include <functional>
+#include <mutex>
+#include <vector>
+
 class TestI : public ::Test::TestIntf
 {
 public:
@@ -12,9 +16,16 @@ public:
 
     std::string getReplicaId(const Ice::Current&) override;
     std::string getReplicaIdAndShutdown(const Ice::Current&) override;
+    void startDispatchAsync(
+        std::function<void()>,
+        std::function<void(std::exception_ptr)>,
+        const Ice::Current&) override;
+    void finishDispatches(const Ice::Current&) override;
 
 private:
     Ice::PropertiesPtr _properties;
+    std::vector<std::function<void()>> _pending;
+    std::mutex _mutex;
 };
 
 #endif
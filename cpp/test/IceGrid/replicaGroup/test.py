@@ -2,7 +2,7 @@
 
 import os
 
-from IceGridUtil import IceGridClient, IceGridRegistryMaster, IceGridTestCase
+from IceGridUtil import IceGridClient, IceGridNode, IceGridRegistryMaster, IceGridTestCase
 from Util import TestSuite, Windows, platform
 
 registryProps = {
@@ -17,6 +17,8 @@ registryTraceProps = {
     "Ice.Trace.Protocol": 1,
 }
 
+nodeProps = {"IceGrid.Node.LiveLoadPeriod": 1000}
+
 clientProps = {"Ice.RetryIntervals": "0 50 100 250"}
 clientTraceProps = {"Ice.Trace.Locator": 2, "Ice.Trace.Protocol": 1}
 
@@ -26,6 +28,7 @@ if isinstance(platform, Windows) or os.getuid() != 0:
         [
             IceGridTestCase(
                 icegridregistry=[IceGridRegistryMaster(props=registryProps, traceProps=registryTraceProps)],
+                icegridnode=IceGridNode(props=nodeProps),
                 client=IceGridClient(props=clientProps, traceProps=clientTraceProps),
             )
         ],
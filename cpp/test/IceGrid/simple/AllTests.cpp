@@ -6,9 +6,61 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <atomic>
+
 using namespace std;
 using namespace Test;
 
+// Forwards the requests to the IceGrid locator, and counts the findObjectById and findAdapterById requests.
+class CountingLocatorI final : public IceGrid::Locator
+{
+public:
+    CountingLocatorI(IceGrid::LocatorPrx locator) : _locator(std::move(locator)) {}
+
+    [[nodiscard]] optional<Ice::ObjectPrx> findObjectById(Ice::Identity id, const Ice::Current&) const final
+    {
+        ++_requestCount;
+        return _locator->findObjectById(id);
+    }
+
+    [[nodiscard]] optional<Ice::ObjectPrx> findAdapterById(string id, const Ice::Current&) const final
+    {
+        ++_requestCount;
+        return _locator->findAdapterById(id);
+    }
+
+    [[nodiscard]] optional<Ice::LocatorRegistryPrx> getRegistry(const Ice::Current&) const final
+    {
+        return _locator->getRegistry();
+    }
+
+    [[nodiscard]] optional<IceGrid::RegistryPrx> getLocalRegistry(const Ice::Current&) const final
+    {
+        return _locator->getLocalRegistry();
+    }
+
+    [[nodiscard]] optional<IceGrid::QueryPrx> getLocalQuery(const Ice::Current&) const final
+    {
+        return _locator->getLocalQuery();
+    }
+
+    [[nodiscard]] Ice::ObjectProxySeq findAdaptersByIds(Ice::StringSeq ids, const Ice::Current&) const final
+    {
+        return _locator->findAdaptersByIds(ids);
+    }
+
+    [[nodiscard]] Ice::ObjectProxySeq findObjectsByIds(Ice::IdentitySeq ids, const Ice::Current&) const final
+    {
+        return _locator->findObjectsByIds(ids);
+    }
+
+    [[nodiscard]] int getRequestCount() const { return _requestCount; }
+
+private:
+    const IceGrid::LocatorPrx _locator;
+    mutable atomic<int> _requestCount{0};
+};
+
 void
 allTests(Test::TestHelper* helper)
 {
@@ -282,6 +334,44 @@ allTestsWithDeploy(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing bulk locator requests... " << flush;
+    {
+        auto locator = Ice::uncheckedCast<IceGrid::LocatorPrx>(communicator->getDefaultLocator().value());
+
+        Ice::ObjectProxySeq adapters = locator->findAdaptersByIds({"TestAdapter", "TestAdapterUnknown"});
+        test(adapters.size() == 2);
+        test(adapters[0] && !adapters[0]->ice_getEndpoints().empty());
+        test(!adapters[1]);
+
+        Ice::ObjectProxySeq objects =
+            locator->findObjectsByIds({Ice::stringToIdentity("test"), Ice::stringToIdentity("unknown/unknown")});
+        test(objects.size() == 2);
+        test(objects[0] && objects[0]->ice_getIdentity() == Ice::stringToIdentity("test"));
+        test(!objects[1]);
+
+        test(locator->findAdaptersByIds({}).empty());
+        test(locator->findObjectsByIds({}).empty());
+
+        // Prefetch the locator cache of a locator that counts the findObjectById and findAdapterById requests: the
+        // proxies are then resolved from the locator cache, without calling the locator.
+        auto adapter = communicator->createObjectAdapterWithEndpoints("CountingLocator", "default");
+        auto countingLocatorI = make_shared<CountingLocatorI>(locator);
+        auto countingLocator =
+            adapter->add<IceGrid::LocatorPrx>(countingLocatorI, Ice::stringToIdentity("CountingLocator"));
+        adapter->activate();
+
+        IceGrid::prefetchLocatorCache(countingLocator, {"TestAdapter"}, {Ice::stringToIdentity("test")});
+        obj->ice_locator(countingLocator)->ice_ping();
+        obj2->ice_locator(countingLocator)->ice_ping();
+        test(countingLocatorI->getRequestCount() == 0);
+
+        // Without the locator cache, the proxies are resolved with the locator.
+        obj->ice_locator(countingLocator)->ice_locatorCacheTimeout(0)->ice_ping();
+        test(countingLocatorI->getRequestCount() == 1);
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
     IceGrid::RegistryPrx registry(
         communicator,
         communicator->getDefaultLocator()->ice_getIdentity().category + "/Registry");
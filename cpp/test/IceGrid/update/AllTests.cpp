@@ -1182,6 +1182,126 @@ allTests(Test::TestHelper* helper)
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing incremental update... " << flush;
+
+        auto server = make_shared<ServerDescriptor>();
+        server->id = "${name}";
+        server->exe = "${test.dir}/server";
+        server->pwd = ".";
+        server->allocatable = false;
+        addProperty(server, "Ice.Admin.Endpoints", "tcp -h 127.0.0.1");
+        addProperty(server, "Server.Endpoints", "default");
+        addProperty(server, "ApplicationVar", "${appvar}");
+        addProperty(server, "NodeVar", "${nodevar}");
+        addProperty(server, "ServerParamVar", "${serverparamvar}");
+        AdapterDescriptor adapter;
+        adapter.name = "Server";
+        adapter.id = "${server}";
+        adapter.serverLifetime = true;
+        server->adapters.push_back(adapter);
+
+        TemplateDescriptor templ;
+        templ.parameters.emplace_back("name");
+        templ.parameters.emplace_back("serverparamvar");
+        templ.descriptor = server;
+
+        ApplicationDescriptor testApp;
+        testApp.name = "TestApp";
+        testApp.variables["test.dir"] = properties->getProperty("ServerDir");
+        testApp.variables["appvar"] = "AppValue";
+        testApp.serverTemplates["ServerTemplate"] = templ;
+
+        ServerInstanceDescriptor instance;
+        instance.templateName = "ServerTemplate";
+        instance.parameterValues["serverparamvar"] = "ServerParamValue";
+        instance.parameterValues["name"] = "Server1";
+        testApp.nodes["localnode"].serverInstances.push_back(instance);
+        instance.parameterValues["name"] = "Server2";
+        testApp.nodes["localnode"].serverInstances.push_back(instance);
+        testApp.nodes["localnode"].variables["nodevar"] = "NodeValue";
+        instance.parameterValues["name"] = "Server3";
+        testApp.nodes["node1"].serverInstances.push_back(instance);
+        testApp.nodes["node1"].variables["nodevar"] = "NodeValue";
+
+        try
+        {
+            admin->addApplication(testApp);
+        }
+        catch (const DeploymentException& ex)
+        {
+            cerr << ex.reason << endl;
+            test(false);
+        }
+
+        auto serverProperty = [&admin](const string& id, const string& name)
+        {
+            ServerInfo info = admin->getServerInfo(id);
+            test(info.descriptor);
+            return getProperty(info.descriptor->propertySet.properties, name);
+        };
+
+        admin->startServer("Server1");
+        admin->startServer("Server2");
+        int pid = admin->getServerPid("Server1");
+
+        // Only the updated server instance is instantiated again, the other servers are left unchanged.
+        ApplicationUpdateDescriptor empty;
+        empty.name = "TestApp";
+        NodeUpdateDescriptor node;
+        node.name = "localnode";
+        empty.nodes.push_back(node);
+
+        ApplicationUpdateDescriptor update = empty;
+        instance.parameterValues["name"] = "Server2";
+        instance.parameterValues["serverparamvar"] = "UpdatedServerParamValue";
+        update.nodes[0].serverInstances.push_back(instance);
+        try
+        {
+            admin->updateApplication(update);
+        }
+        catch (const DeploymentException& ex)
+        {
+            cerr << ex.reason << endl;
+            test(false);
+        }
+        test(serverProperty("Server1", "ServerParamVar") == "ServerParamValue");
+        test(serverProperty("Server2", "ServerParamVar") == "UpdatedServerParamValue");
+        test(serverProperty("Server3", "ServerParamVar") == "ServerParamValue");
+        test(admin->getServerState("Server1") == ServerState::Active);
+        test(admin->getServerPid("Server1") == pid);
+
+        // A node variable update only changes the servers of this node.
+        update = empty;
+        update.nodes[0].variables["nodevar"] = "UpdatedNodeValue";
+        admin->updateApplication(update);
+        test(serverProperty("Server1", "NodeVar") == "UpdatedNodeValue");
+        test(serverProperty("Server2", "NodeVar") == "UpdatedNodeValue");
+        test(serverProperty("Server3", "NodeVar") == "NodeValue");
+        test(serverProperty("Server2", "ServerParamVar") == "UpdatedServerParamValue");
+
+        // Application variable and template updates change the servers of every node.
+        update = empty;
+        update.variables["appvar"] = "UpdatedAppValue";
+        admin->updateApplication(update);
+        test(serverProperty("Server1", "ApplicationVar") == "UpdatedAppValue");
+        test(serverProperty("Server2", "ApplicationVar") == "UpdatedAppValue");
+        test(serverProperty("Server3", "ApplicationVar") == "UpdatedAppValue");
+
+        update = empty;
+        addProperty(server, "TemplateVar", "TemplateValue");
+        update.serverTemplates["ServerTemplate"] = templ;
+        admin->updateApplication(update);
+        test(serverProperty("Server1", "TemplateVar") == "TemplateValue");
+        test(serverProperty("Server2", "TemplateVar") == "TemplateValue");
+        test(serverProperty("Server3", "TemplateVar") == "TemplateValue");
+        test(serverProperty("Server3", "NodeVar") == "NodeValue");
+
+        admin->removeApplication("TestApp");
+
+        cout << "ok" << endl;
+    }
+
     {
         cout << "testing server node move... " << flush;
 
@@ -125,6 +125,38 @@ private:
     condition_variable _condVar;
 };
 
+// A servant that receives the events sent to a topic's multicast group, and records their sequence numbers.
+class MulticastSingleI final : public Single
+{
+public:
+    void event(int, const Current& current) override
+    {
+        auto p = current.ctx.find("_seq");
+        test(p != current.ctx.end());
+        test(current.con->type() == "udp");
+        lock_guard<mutex> lg(_mutex);
+        _sequences.push_back(stoll(p->second));
+        _condVar.notify_all();
+    }
+
+    // Waits for the given number of events. Datagrams can be lost: the wait returns the events received so far if
+    // it times out after receiving some events.
+    vector<int64_t> waitForEvents(size_t n)
+    {
+        unique_lock<mutex> lock(_mutex);
+        if (!_condVar.wait_for(lock, 30s, [&] { return _sequences.size() >= n; }))
+        {
+            test(!_sequences.empty());
+        }
+        return _sequences;
+    }
+
+private:
+    vector<int64_t> _sequences;
+    mutex _mutex;
+    condition_variable _condVar;
+};
+
 class Subscriber final : public Test::TestHelper
 {
 public:
@@ -314,6 +346,89 @@ Subscriber::run(int argc, char** argv)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing multicast delivery ... " << flush;
+    {
+        // The "single" topic has no multicast group.
+        try
+        {
+            IceStorm::QoS qos;
+            qos["multicast"] = "1";
+            topic->subscribeAndGetPublisher(qos, adapter->addWithUUID(make_shared<CountingSingleI>())->ice_oneway());
+            test(false);
+        }
+        catch (const IceStorm::BadQoS&)
+        {
+        }
+
+        auto multicastTopic = manager->create("multicast");
+        try
+        {
+            IceStorm::QoS qos;
+            qos["multicast"] = "yes";
+            multicastTopic->subscribeAndGetPublisher(
+                qos,
+                adapter->addWithUUID(make_shared<CountingSingleI>())->ice_oneway());
+            test(false);
+        }
+        catch (const IceStorm::BadQoS&)
+        {
+        }
+
+        // The group proxy configured with IceStorm.Multicast.multicast has the "multicast" identity.
+        ostringstream endpoint;
+        if (properties->getIceProperty("Ice.IPv6") == "1")
+        {
+            endpoint << "udp -h \"ff15::1:1\" -p " << getTestPort(20);
+        }
+        else
+        {
+            endpoint << "udp -h 239.255.1.1 -p " << getTestPort(20);
+        }
+        properties->setProperty("MulticastAdapter.Endpoints", endpoint.str());
+        properties->setProperty("MulticastAdapter.ThreadPool.Size", "1");
+        auto multicastAdapter = communicator->createObjectAdapter("MulticastAdapter");
+        auto group = make_shared<MulticastSingleI>();
+        multicastAdapter->add(group, Ice::stringToIdentity("multicast"));
+        multicastAdapter->activate();
+
+        // The events of the multicast subscribers are sent to the group, not to the subscribers' own proxy.
+        IceStorm::QoS qos;
+        qos["multicast"] = "1";
+        vector<shared_ptr<CountingSingleI>> multicastCounters;
+        for (int i = 0; i < 2; ++i)
+        {
+            multicastCounters.push_back(make_shared<CountingSingleI>());
+            multicastTopic->subscribeAndGetPublisher(qos, adapter->addWithUUID(multicastCounters.back())->ice_oneway());
+        }
+
+        auto onewayCounter = make_shared<CountingSingleI>();
+        multicastTopic->subscribeAndGetPublisher(IceStorm::QoS(), adapter->addWithUUID(onewayCounter)->ice_oneway());
+
+        const int count = 20;
+        auto publisher = uncheckedCast<SinglePrx>(multicastTopic->getPublisher()->ice_twoway());
+        for (int i = 0; i < count; ++i)
+        {
+            publisher->event(i);
+        }
+
+        // Each event is sent once to the group, for all the multicast subscribers, with its sequence number.
+        vector<int64_t> sequences = group->waitForEvents(count);
+        // The events are sent to the group in sequence order.
+        test(is_sorted(sequences.begin(), sequences.end()));
+        test(adjacent_find(sequences.begin(), sequences.end()) == sequences.end());
+        test(sequences.front() >= 1 && sequences.back() <= count);
+
+        onewayCounter->waitForCount(count);
+        for (const auto& counter : multicastCounters)
+        {
+            test(counter->count() == 0);
+        }
+
+        multicastTopic->destroy();
+        multicastAdapter->destroy();
+    }
+    cout << "ok" << endl;
 }
 
 DEFINE_TEST(Subscriber)
@@ -9,9 +9,22 @@
 from __future__ import annotations
 
 from IceStormUtil import IceStorm, IceStormTestCase, Publisher, Subscriber
-from Util import ClientServerTestCase, Driver, TestSuite
+from Util import ClientServerTestCase, Darwin, Driver, Process, Props, TestSuite, platform
+
+
+def props(process: Process, current: Driver.Current) -> Props:
+    # The "multicast" topic sends the events of its multicast subscribers to this group.
+    port = current.driver.getTestPort(20)
+    group = f'udp -h "ff15::1:1" -p {port}' if current.config.ipv6 else f"udp -h 239.255.1.1 -p {port}"
+    if isinstance(platform, Darwin):
+        # Use loopback on macOS to run successfully on GitHub runners.
+        group += ' --interface "::1"' if current.config.ipv6 else " --interface 127.0.0.1"
+    return {
+        "Ice.UDP.SndSize": 512 * 1024,
+        "Ice.Warn.Dispatch": 0,
+        "IceStorm.Multicast.multicast": f"multicast -d:{group}",
+    }
 
-props = {"Ice.UDP.SndSize": 512 * 1024, "Ice.Warn.Dispatch": 0}
 persistent = IceStorm(props=props)
 transient = IceStorm(props=props, transient=True)
 replicated = [IceStorm(replica=i, nreplicas=3, props=props) for i in range(0, 3)]
@@ -181,7 +181,7 @@ class ReplicaGroupEditor extends Editor {
         JTextField loadSampleTextField = (JTextField) _loadSample.getEditor().getEditorComponent();
         loadSampleTextField.getDocument().addDocumentListener(_updateListener);
         _loadSample.setToolTipText(
-            "Use the load average or CPU usage over the last 1, 5 or 15 minutes?");
+            "Use the load average or CPU usage over the last 1, 5 or 15 minutes, or the live load of the replicas?");
 
         _proxyOptions.getDocument().addDocumentListener(_updateListener);
         _proxyOptions.setToolTipText(
@@ -417,7 +417,7 @@ class ReplicaGroupEditor extends Editor {
     private JTextField _nReplicas = new JTextField(20);
 
     private JLabel _loadSampleLabel;
-    private JComboBox _loadSample = new JComboBox(new String[]{"1", "5", "15"});
+    private JComboBox _loadSample = new JComboBox(new String[]{"1", "5", "15", "live"});
 
     private ArrayMapField _objects;
     private LinkedList<ObjectDescriptor> _objectList;
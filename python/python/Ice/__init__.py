@@ -151,6 +151,7 @@ from .RouterFinder import RouterFinder, RouterFinderPrx
 from .RouterFinder_forward import _Ice_RouterFinderPrx_t
 from .ServantLocator import ServantLocator
 from .ServerNotFoundException import ServerNotFoundException, _Ice_ServerNotFoundException_t
+from .SHMEndpointType import SHMEndpointType
 from .ShortSeq import _Ice_ShortSeq_t
 from .SliceChecksumDict import _Ice_SliceChecksumDict_t
 from .SlicedData import SlicedData
@@ -287,6 +288,7 @@ __all__ = [
     "RouterFinder",
     "RouterFinderPrx",
     "RouterPrx",
+    "SHMEndpointType",
     "SSLConnectionInfo",
     "SSLEndpointInfo",
     "SSLEndpointType",
@@ -122,6 +122,13 @@ class Ice(Util.Component):
         match = re.match(r"^([\w]*).*", testId)
         assert match is not None
         parent = match.group(1)
+
+        # The shared memory transport is only available on Linux and macOS.
+        if testId == "Ice/shm" and (
+            isinstance(Util.platform, Util.Windows) or current.config.buildPlatform in ["iphoneos", "iphonesimulator"]
+        ):
+            return False
+
         if isinstance(Util.platform, Util.Linux):
             if Util.platform.getLinuxId() in ["centos", "rhel", "fedora"] and current.config.buildPlatform == "x86":
                 #
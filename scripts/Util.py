@@ -1202,6 +1202,8 @@ class Mapping(object):
         if isinstance(process, IceProcess):
             if current.config.protocol in ["bt", "bts"]:
                 props["Ice.Plugin.IceBT"] = self.getPluginEntryPoint("IceBT", process, current)
+            if current.config.protocol == "shm":
+                props["Ice.Plugin.IceSHM"] = self.getPluginEntryPoint("IceSHM", process, current)
             if current.config.protocol in ["ssl", "wss", "bts", "iaps"]:
                 props.update(self.getSSLProps(process, current))
         return props
@@ -4149,6 +4151,7 @@ class CppMapping(Mapping):
         return {
             "IceSSL": "IceSSL:createIceSSL",
             "IceBT": "IceBT:createIceBT",
+            "IceSHM": "Ice:createIceSHM",
             "IceDiscovery": "IceDiscovery:createIceDiscovery",
             "IceLocatorDiscovery": "IceLocatorDiscovery:createIceLocatorDiscovery",
         }[plugin]
@@ -39,5 +39,17 @@ Glacier2TestSuite(
             clients=[Client(), Client(args=["--shutdown"])],
             traceProps=traceProps,
         ),
+        ClientServerTestCase(
+            name="client/server with router and batched oneway forwarding",
+            servers=[
+                Glacier2Router(
+                    passwords=passwords,
+                    props={"Glacier2.Client.BatchInterval": 10, "Glacier2.Server.BatchInterval": 10},
+                ),
+                Server(),
+            ],
+            clients=[Client(), Client(args=["--shutdown"])],
+            traceProps=traceProps,
+        ),
     ],
 )